@@ -0,0 +1,276 @@
+#include "ocilib.h"
+
+/* This program checks that the NUMBER conversions performed by OCILIB without calling OCI
+   give exactly the same results as the OCI number functions, over random values.
+
+   It calls the OCI number functions directly, so it must be built with OCI_IMPORT_LINKAGE
+   and OCI_CHARSET_ANSI, and it requires the following type :
+
+   create type t_number_array as varray(1) of number
+*/
+
+#include <oci.h>
+
+#define NB_VALUES    1000000
+#define NB_ROWS      100000
+#define FETCH_SIZE   100
+
+static OCIEnv   *env;
+static OCIError *err;
+
+static unsigned int nb_values = 0;
+static unsigned int nb_errors = 0;
+
+static big_uint random_bits(void)
+{
+    big_uint value = 0;
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        value = (value << 16) ^ (big_uint) (rand() & 0xFFFF);
+    }
+
+    return value;
+}
+
+static double random_double(unsigned int i)
+{
+    big_uint bits = random_bits();
+    double value = 0.0;
+    int k;
+
+    switch (i % 3)
+    {
+        case 0:
+        {
+            /* any finite double */
+
+            do
+            {
+                bits  = random_bits();
+                memcpy(&value, &bits, sizeof(value));
+            }
+            while (value != value || value - value != 0.0);
+            break;
+        }
+        case 1:
+        {
+            /* short decimal values, the most common ones */
+
+            value = (double) (bits % 1000000000);
+
+            for (k = (int) ((bits >> 32) % 12); k > 0; k--)
+            {
+                value /= 10;
+            }
+            break;
+        }
+        default:
+        {
+            /* binary fractions */
+
+            value = (double) (big_int) (bits % 2000000000000) / (double) (1 << ((bits >> 48) % 20));
+            break;
+        }
+    }
+
+    return (bits & 0x8000) ? -value : value;
+}
+
+static OCINumber * get_raw_number(OCI_Coll *coll)
+{
+    boolean exists = FALSE;
+    dvoid  *elem   = NULL;
+    dvoid  *ind    = NULL;
+
+    OCICollGetElem(env, err, (OCIColl *) OCI_HandleGetColl(coll), 0, &exists, &elem, &ind);
+
+    return (OCINumber *) elem;
+}
+
+static void check_number(const char *what, const char *value, const OCINumber *num1, const OCINumber *num2)
+{
+    if (memcmp(num1->OCINumberPart, num2->OCINumberPart, num2->OCINumberPart[0] + 1))
+    {
+        printf("%s mismatch for %s\n", what, value);
+        nb_errors++;
+    }
+}
+
+static void check_bytes(const char *what, const char *value, const void *val1, const void *val2, size_t size)
+{
+    if (memcmp(val1, val2, size))
+    {
+        printf("%s mismatch for %s\n", what, value);
+        nb_errors++;
+    }
+}
+
+static void check_values(OCI_Coll *coll, OCI_Elem *elem)
+{
+    OCINumber num;
+    unsigned int i;
+    char str[64];
+
+    for (i = 0; i < NB_VALUES; i++)
+    {
+        double  dval1 = random_double(i), dval2 = 0.0;
+        big_int ival1 = (big_int) random_bits(), ival2 = 0;
+        int     nval1 = (int) (ival1 >> 40), nval2 = 0;
+
+        /* double encoding and decoding */
+
+        sprintf(str, "%.17g", dval1);
+
+        OCI_ElemSetDouble(elem, dval1);
+        OCI_CollSetElem(coll, 1, elem);
+        OCINumberFromReal(err, &dval1, sizeof(dval1), &num);
+        check_number("double encoding", str, get_raw_number(coll), &num);
+
+        dval1 = OCI_ElemGetDouble(elem);
+        OCINumberToReal(err, &num, sizeof(dval2), &dval2);
+        check_bytes("double decoding", str, &dval1, &dval2, sizeof(dval1));
+
+        /* big integer encoding and decoding */
+
+        sprintf(str, "%lld", (long long) ival1);
+
+        OCI_ElemSetBigInt(elem, ival1);
+        OCI_CollSetElem(coll, 1, elem);
+        OCINumberFromInt(err, &ival1, sizeof(ival1), OCI_NUMBER_SIGNED, &num);
+        check_number("big integer encoding", str, get_raw_number(coll), &num);
+
+        ival1 = OCI_ElemGetBigInt(elem);
+        OCINumberToInt(err, &num, sizeof(ival2), OCI_NUMBER_SIGNED, &ival2);
+        check_bytes("big integer decoding", str, &ival1, &ival2, sizeof(ival1));
+
+        /* integer encoding and decoding */
+
+        sprintf(str, "%d", nval1);
+
+        OCI_ElemSetInt(elem, nval1);
+        OCI_CollSetElem(coll, 1, elem);
+        OCINumberFromInt(err, &nval1, sizeof(nval1), OCI_NUMBER_SIGNED, &num);
+        check_number("integer encoding", str, get_raw_number(coll), &num);
+
+        nval1 = OCI_ElemGetInt(elem);
+        OCINumberToInt(err, &num, sizeof(nval2), OCI_NUMBER_SIGNED, &nval2);
+        check_bytes("integer decoding", str, &nval1, &nval2, sizeof(nval1));
+
+        nb_values += 3;
+    }
+}
+
+static void check_strings(OCI_Statement *st)
+{
+    OCI_Resultset *rs;
+    const void *data = NULL;
+    unsigned int size = 0;
+    oratext str[128];
+    ub4 len;
+
+    /* random numbers of any scale and their text representation in the default format */
+
+    OCI_SetFetchSize(st, FETCH_SIZE);
+    OCI_ExecuteStmtFmt(st, "select n, to_char(n, %s) from "
+                           "(select round(dbms_random.normal * power(10, trunc(dbms_random.value(-30, 30))), "
+                           "trunc(dbms_random.value(0, 40))) n from dual connect by level <= %i)",
+                           OCI_STRING_FORMAT_NUM, NB_ROWS);
+
+    rs = OCI_GetResultset(st);
+
+    while (OCI_FetchNext(rs))
+    {
+        const char *text = OCI_GetString(rs, 2);
+        OCINumber *num;
+        OCINumber ref;
+        big_int ival1 = 0, ival2 = 0;
+
+        /* raw value of the current row within the fetched block */
+
+        OCI_GetColumnBlock(rs, 1, &data, &size, NULL, NULL, NULL);
+
+        num = (OCINumber *) (((const char *) data) + ((OCI_GetCurrentRow(rs) - 1) % FETCH_SIZE) * size);
+
+        /* number to text decoding */
+
+        len = sizeof(str);
+        OCINumberToText(err, num, (oratext *) OCI_STRING_FORMAT_NUM, (ub4) strlen(OCI_STRING_FORMAT_NUM),
+                        NULL, 0, &len, str);
+
+        if (len > 0 && (str[len - 1] == '.' || str[len - 1] == ','))
+        {
+            len--;
+        }
+
+        str[len] = 0;
+
+        if (strcmp(OCI_GetString(rs, 1), (char *) str))
+        {
+            printf("text decoding mismatch for %s\n", str);
+            nb_errors++;
+        }
+
+        /* text to big integer encoding, for the values that fit */
+
+        memset(&ref, 0, sizeof(ref));
+        OCINumberFromText(err, (oratext *) text, (ub4) strlen(text), (oratext *) OCI_STRING_FORMAT_NUM,
+                          (ub4) strlen(OCI_STRING_FORMAT_NUM), NULL, 0, &ref);
+
+        if (OCI_SUCCESS == OCINumberToInt(err, &ref, sizeof(ival2), OCI_NUMBER_SIGNED, &ival2))
+        {
+            ival1 = OCI_GetBigInt(rs, 2);
+
+            check_bytes("text encoding", text, &ival1, &ival2, sizeof(ival1));
+        }
+
+        nb_values += 2;
+    }
+}
+
+int main(void)
+{
+    OCI_Connection *cn;
+    OCI_Statement  *st;
+    OCI_TypeInfo   *tif;
+    OCI_Coll       *coll;
+    OCI_Elem       *elem;
+
+    if (!OCI_Initialize(NULL, NULL, OCI_ENV_DEFAULT))
+        return EXIT_FAILURE;
+
+    cn  = OCI_ConnectionCreate("db", "usr", "pwd", OCI_SESSION_DEFAULT);
+    st  = OCI_StatementCreate(cn);
+
+    env = (OCIEnv *) OCI_HandleGetEnvironment();
+    OCIHandleAlloc(env, (dvoid **) &err, OCI_HTYPE_ERROR, 0, NULL);
+
+    srand((unsigned int) time(NULL));
+
+    /* encoding and decoding of native values through collection elements */
+
+    tif  = OCI_TypeInfoGet(cn, "t_number_array", OCI_TIF_TYPE);
+    coll = OCI_CollCreate(tif);
+    elem = OCI_ElemCreate(tif);
+
+    OCI_ElemSetInt(elem, 0);
+    OCI_CollAppend(coll, elem);
+
+    check_values(coll, elem);
+
+    OCI_ElemFree(elem);
+    OCI_CollFree(coll);
+
+    /* decoding to text and encoding from text through fetched values */
+
+    check_strings(st);
+
+    printf("%u value(s) checked, %u mismatch(es)\n", nb_values, nb_errors);
+
+    OCIHandleFree(err, OCI_HTYPE_ERROR);
+
+    OCI_Cleanup();
+
+    return nb_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+#include "ocilib.h"
+
+/* This program measures the cost of creating and freeing statements on a connection
+   that holds a large number of live statements.
+
+   Statements are tracked by their connection in an OCI_List. Appending and removing
+   items are constant time operations, so the cost of a create/free cycle must not
+   depend on the number of statements already alive on the connection.
+*/
+
+#define NB_STATEMENTS   100000
+#define NB_CYCLES       100000
+
+static double elapsed(clock_t start)
+{
+    return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void create_free_cycles(OCI_Connection *cn, unsigned int nb_live)
+{
+    clock_t start = clock();
+    unsigned int i;
+
+    for (i = 0; i < NB_CYCLES; i++)
+    {
+        OCI_StatementFree(OCI_StatementCreate(cn));
+    }
+
+    printf("%u create/free cycles with %6u live statements : %.3f s\n", NB_CYCLES, nb_live, elapsed(start));
+}
+
+int main(void)
+{
+    OCI_Connection *cn;
+    OCI_Statement **stmts;
+    clock_t start;
+    unsigned int i;
+
+    if (!OCI_Initialize(NULL, NULL, OCI_ENV_DEFAULT))
+        return EXIT_FAILURE;
+
+    cn    = OCI_ConnectionCreate("db", "usr", "pwd", OCI_SESSION_DEFAULT);
+    stmts = (OCI_Statement **) calloc(NB_STATEMENTS, sizeof(*stmts));
+
+    if (!cn || !stmts)
+    {
+        free(stmts);
+        OCI_Cleanup();
+        return EXIT_FAILURE;
+    }
+
+    /* reference cost with no other statement */
+
+    create_free_cycles(cn, 0);
+
+    /* creating the live statements */
+
+    start = clock();
+
+    for (i = 0; i < NB_STATEMENTS; i++)
+    {
+        stmts[i] = OCI_StatementCreate(cn);
+    }
+
+    printf("%u statements created : %.3f s\n", NB_STATEMENTS, elapsed(start));
+
+    /* same cost expected with all the live statements */
+
+    create_free_cycles(cn, NB_STATEMENTS);
+
+    /* freeing the live statements from the middle of the list */
+
+    start = clock();
+
+    for (i = 0; i < NB_STATEMENTS; i += 2)
+    {
+        OCI_StatementFree(stmts[i]);
+    }
+
+    for (i = 1; i < NB_STATEMENTS; i += 2)
+    {
+        OCI_StatementFree(stmts[NB_STATEMENTS - i]);
+    }
+
+    printf("%u statements freed : %.3f s\n", NB_STATEMENTS, elapsed(start));
+
+    free(stmts);
+
+    OCI_Cleanup();
+
+    return EXIT_SUCCESS;
+}
@@ -943,6 +943,98 @@ typedef void (*POCI_HA_HANDLER)
     OCI_Timestamp  *time
 );
 
+/**
+ * @var POCI_PARTITION_FETCH
+ *
+ * @brief
+ * Parallel query row callback prototype.
+ *
+ * @param rs        - Resultset handle of the partition positioned on the fetched row
+ * @param partition - Index of the partition (from 0 to the number of partitions - 1)
+ * @param arg       - Pointer passed to OCI_PoolExecuteParallel()
+ *
+ * @return
+ * User callback should return TRUE to continue fetching the partition or FALSE to stop it
+ *
+ */
+
+typedef unsigned int (*POCI_PARTITION_FETCH)
+(
+    OCI_Resultset *rs,
+    unsigned int   partition,
+    void          *arg
+);
+
+/**
+ * @var POCI_CHUNK_FILL
+ *
+ * @brief
+ * Chunked array DML fill callback prototype.
+ *
+ * @param stmt - Statement handle
+ * @param size - Number of rows the bind arrays can hold
+ * @param arg  - Pointer passed to OCI_ExecuteChunked()
+ *
+ * @return
+ * User callback should return the number of rows written in the bind arrays.
+ * Returning less than 'size' rows ends the input
+ *
+ */
+
+typedef unsigned int (*POCI_CHUNK_FILL)
+(
+    OCI_Statement *stmt,
+    unsigned int   size,
+    void          *arg
+);
+
+/**
+ * @var POCI_MEM_ALLOC
+ *
+ * @brief
+ * Memory allocation callback prototype (same contract as malloc()).
+ *
+ * @param size - Number of bytes to allocate
+ *
+ */
+
+typedef void * (*POCI_MEM_ALLOC)
+(
+    size_t size
+);
+
+/**
+ * @var POCI_MEM_REALLOC
+ *
+ * @brief
+ * Memory reallocation callback prototype (same contract as realloc()).
+ *
+ * @param ptr  - Pointer to the memory block to resize
+ * @param size - New size in bytes
+ *
+ */
+
+typedef void * (*POCI_MEM_REALLOC)
+(
+    void  *ptr,
+    size_t size
+);
+
+/**
+ * @var POCI_MEM_FREE
+ *
+ * @brief
+ * Memory release callback prototype (same contract as free()).
+ *
+ * @param ptr - Pointer to the memory block to release
+ *
+ */
+
+typedef void (*POCI_MEM_FREE)
+(
+    void *ptr
+);
+
 /* public structures */
 
 /**
@@ -1006,7 +1098,7 @@ typedef union OCI_Variant {
 * @brief
 * Hash table entry value
 *
-* OCILIB implementation of hash tables uses chaining method for dealing with collisions
+* Each hash table entry holds a linked list of values
 *
 */
 
@@ -1134,8 +1226,9 @@ typedef unsigned int big_uint;
 #define OCI_ERR_TYPEINFO_DATATYPE           25
 #define OCI_ERR_ITEM_NOT_FOUND              26
 #define OCI_ERR_ARG_INVALID_VALUE           27
+#define OCI_ERR_ASYNC_PENDING               28
 
-#define OCI_ERR_COUNT                       28
+#define OCI_ERR_COUNT                       29
 
 /* binding */
 
@@ -1150,6 +1243,10 @@ typedef unsigned int big_uint;
 #define OCI_PREFETCH_SIZE                   20
 #define OCI_LONG_EXPLICIT                   1
 #define OCI_LONG_IMPLICIT                   2
+#define OCI_NDM_NUMBER                      1
+#define OCI_NDM_NATIVE                      2
+#define OCI_LDM_LOCATOR                     1
+#define OCI_LDM_INLINE                      2
 
 /* unknown value */
 
@@ -1211,6 +1308,7 @@ typedef unsigned int big_uint;
 #define OCI_ENV_THREADED                    1
 #define OCI_ENV_CONTEXT                     2
 #define OCI_ENV_EVENTS                      4
+#define OCI_ENV_MEMORY_STATS                8
 
 /* sessions modes */
 
@@ -1279,6 +1377,13 @@ typedef unsigned int big_uint;
 #define OCI_CSF_DEFAULT                     1
 #define OCI_CSF_NATIONAL                    2
 
+/* non blocking calls status */
+
+#define OCI_ASYNC_ERROR                     0
+#define OCI_ASYNC_PENDING                   1
+#define OCI_ASYNC_DONE                      2
+#define OCI_ASYNC_NO_MORE                   3
+
 /* statement fetch mode */
 
 #define OCI_SFM_DEFAULT                     0
@@ -1647,6 +1752,7 @@ typedef unsigned int big_uint;
 #define OCI_SIZE_FORMAT                     64
 #define OCI_SIZE_BUFFER                     512
 #define OCI_SIZE_LONG                       (64*1024)-1
+#define OCI_SIZE_LOB_INLINE                 4000
 #define OCI_SIZE_DATE                       45
 #define OCI_SIZE_TIMESTAMP                  54
 #define OCI_SIZE_FORMAT_TODATE              14
@@ -1724,6 +1830,7 @@ typedef unsigned int big_uint;
  * - OCI_ENV_THREADED : multi-threading support
  * - OCI_ENV_CONTEXT  : thread contextual error handling
  * - OCI_ENV_EVENTS   : enables events for subscription, HA Events, AQ notifications
+ * - OCI_ENV_MEMORY_STATS : records memory statistics (see OCI_GetMemoryStats())
  *
  * @note
  * This function must be called before any OCILIB library function.
@@ -1768,6 +1875,128 @@ OCI_EXPORT boolean OCI_API OCI_Cleanup
     void
 );
 
+/**
+ * @brief
+ * Install custom memory allocation functions used by the library
+ *
+ * @param alloc_fct   - Allocation function
+ * @param realloc_fct - Reallocation function
+ * @param free_fct    - Release function
+ *
+ * @note
+ * All memory allocated by OCILIB itself goes through these functions.
+ * Memory allocated by the Oracle client is not affected.
+ *
+ * @note
+ * Passing NULL for the three functions restores the C runtime functions
+ *
+ * @warning
+ * This function must be called before OCI_Initialize() or after OCI_Cleanup()
+ *
+ * @return
+ * TRUE on success otherwise FALSE if the library is initialized or if only
+ * some of the functions are provided
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetMemoryHandlers
+(
+    POCI_MEM_ALLOC   alloc_fct,
+    POCI_MEM_REALLOC realloc_fct,
+    POCI_MEM_FREE    free_fct
+);
+
+/**
+ * @brief
+ * Set the maximum number of idle OCI handles kept for reuse per handle type
+ *
+ * @param size - Maximum number of idle handles per type
+ *
+ * @note
+ * Error handles used for array DML errors and descriptors backing OCI_Lob,
+ * OCI_File, OCI_Timestamp and OCI_Interval objects are not released to the
+ * Oracle client when freed but recycled by the next allocation of the same type.
+ *
+ * @note
+ * Default value is 16. Setting it to 0 releases all idle handles and disables recycling
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetHandleCacheSize
+(
+    unsigned int size
+);
+
+/**
+ * @brief
+ * Return the maximum number of idle OCI handles kept for reuse per handle type
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetHandleCacheSize
+(
+    void
+);
+
+/**
+ * @brief
+ * Return memory statistics of the library for a given type of memory block
+ *
+ * @param type       - Memory block type (0 for all types)
+ * @param cur_bytes  - Number of bytes currently allocated
+ * @param max_bytes  - Highest number of bytes allocated at the same time
+ * @param cur_blocks - Number of blocks currently allocated
+ * @param nb_allocs  - Number of allocations since OCI_Initialize()
+ *
+ * @note
+ * Statistics are only recorded when OCI_Initialize() is called with the flag
+ * OCI_ENV_MEMORY_STATS. Each block is then prefixed with a small header holding
+ * its size and type.
+ *
+ * @note
+ * Block types are internal allocation types ranging from 1 to the last value for
+ * which OCI_GetMemoryTypeName() does not return NULL
+ *
+ * @note
+ * Statistics remain available after OCI_Cleanup() until the next call to OCI_Initialize().
+ * Blocks still allocated at OCI_Cleanup() are reported as unfreed data
+ *
+ * @note
+ * Any output parameter can be NULL
+ *
+ * @return
+ * FALSE if statistics are not enabled or if the type is out of range otherwise TRUE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetMemoryStats
+(
+    unsigned int  type,
+    big_uint     *cur_bytes,
+    big_uint     *max_bytes,
+    unsigned int *cur_blocks,
+    big_uint     *nb_allocs
+);
+
+/**
+ * @brief
+ * Return the name of the given memory block type
+ *
+ * @param type - Memory block type
+ *
+ * @return
+ * Type name or NULL if the type is out of range
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_GetMemoryTypeName
+(
+    unsigned int type
+);
+
 /**
  * @brief
  * Return the version of OCI used for compilation
@@ -2835,6 +3064,102 @@ OCI_EXPORT boolean OCI_API OCI_SetStatementCacheSize
     unsigned int     value
 );
 
+/**
+ * @brief
+ * Return a prepared statement for the given SQL from the connection statement object cache
+ *
+ * @param con - Connection handle
+ * @param sql - SQL order - PL/SQL block
+ *
+ * @note
+ * On a cache miss, a new statement is created, prepared and added to the cache.
+ * On a cache hit, the cached statement is returned as left by its last use:
+ * its binds, its resultset column descriptions and its define buffers are kept
+ * and reused by the next OCI_Execute() call.
+ *
+ * @note
+ * When the cache is full, the least recently used statement is freed.
+ *
+ * @warning
+ * Cached statements are owned by the cache. They must not be prepared again with
+ * another SQL order and pointers to them must not be kept across calls as they
+ * are freed when evicted. They can be freed with OCI_StatementFree() that removes
+ * them from the cache.
+ *
+ * @return
+ * Statement handle on success otherwise NULL
+ *
+ */
+
+OCI_EXPORT OCI_Statement * OCI_API OCI_GetCachedStatement
+(
+    OCI_Connection *con,
+    const otext    *sql
+);
+
+/**
+ * @brief
+ * Return the maximum number of statements kept in the statement object cache
+ *
+ * @param con - Connection handle
+ *
+ * @note
+ * Default value is 20
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetStatementObjectCacheSize
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Set the maximum number of statements kept in the statement object cache
+ *
+ * @param con   - Connection handle
+ * @param value - maximum number of statements in the cache (at least 1)
+ *
+ * @note
+ * The least recently used statements above the new size are freed
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetStatementObjectCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+);
+
+/**
+ * @brief
+ * Return the number of OCI_GetCachedStatement() calls served from the cache
+ *
+ * @param con - Connection handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetStatementObjectCacheHits
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Return the number of OCI_GetCachedStatement() calls that had to prepare a new statement
+ *
+ * @param con - Connection handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetStatementObjectCacheMisses
+(
+    OCI_Connection *con
+);
+
 /**
  * @brief
  * Return the default LOB prefetch buffer size for the connection
@@ -3229,6 +3554,59 @@ OCI_EXPORT boolean OCI_API OCI_PoolSetStatementCacheSize
     unsigned int  value
 );
 
+/**
+ * @brief
+ * Execute a SELECT statement in parallel partitions, each one fetched from its own
+ * pool connection within its own thread
+ *
+ * @param pool     - Pool handle
+ * @param sql      - SELECT statement to execute
+ * @param key      - Expression on the columns of the statement used to partition the rows
+ * @param nb_parts - Number of partitions
+ * @param proc     - User callback called for each fetched row
+ * @param arg      - User pointer passed to the callback
+ *
+ * @note
+ * The rows are split into disjoint partitions using the predicate
+ * 'ORA_HASH(key, nb_parts - 1) = partition' on top of the given statement.
+ * Choosing a key with many distinct values (primary key, ROWIDTOCHAR(ROWID) selected
+ * by the statement, ...) gives evenly sized partitions.
+ *
+ * @note
+ * For each partition, a worker thread gets a connection from the pool, executes
+ * the partitioned statement and calls the callback for each fetched row.
+ * The function returns once all partitions have been fetched.
+ *
+ * @note
+ * The callback is called concurrently from the worker threads. Thus, any data shared
+ * between partitions must be protected by the callback (e.g. with OCI_Mutex).
+ *
+ * @note
+ * The statement cannot contain bind variables.
+ *
+ * @warning
+ * OCILIB must be initialized with OCI_ENV_THREADED mode and the pool should allow
+ * at least nb_parts connections, otherwise workers wait for busy connections.
+ *
+ * @warning
+ * Errors are raised in the worker threads. If OCI_ENV_CONTEXT mode is enabled, the first
+ * partition error is also raised again in the calling thread.
+ *
+ * @return
+ * TRUE if all partitions have been successfully fetched otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_PoolExecuteParallel
+(
+    OCI_Pool            *pool,
+    const otext         *sql,
+    const otext         *key,
+    unsigned int         nb_parts,
+    POCI_PARTITION_FETCH proc,
+    void                *arg
+);
+
 /**
  * @}
  */
@@ -3619,6 +3997,95 @@ OCI_EXPORT boolean OCI_API OCI_Execute
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Execute a prepared array DML statement over an input of any size
+ *
+ * @param stmt - Statement handle
+ * @param proc - User callback filling the bind arrays
+ * @param arg  - User pointer passed to the callback
+ *
+ * @note
+ * The bind arrays set up with OCI_BindArraySetSize() and the OCI_BindArrayOfXXX()
+ * calls are used as a chunk buffer. The callback is called to fill them, the chunk
+ * is executed and so on until the callback returns less rows than the array size.
+ *
+ * @note
+ * Once completed:
+ * - OCI_GetAffectedRows() returns the number of rows processed over all chunks
+ * - OCI_GetBatchError() and OCI_GetBatchErrorCount() return the rejected rows
+ *   of all chunks with their row offset in the whole input
+ *
+ * @note
+ * Rejected rows do not stop the execution. Any other error stops it.
+ *
+ * @note
+ * Chunks are executed in blocking mode. The call fails with an OCI_ERR_ASYNC_PENDING
+ * error if a non blocking call is pending on the connection.
+ *
+ * @return
+ * TRUE if all rows were processed successfully otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_ExecuteChunked
+(
+    OCI_Statement  *stmt,
+    POCI_CHUNK_FILL proc,
+    void           *arg
+);
+
+/**
+ * @brief
+ * Execute a prepared SQL statement or PL/SQL block without blocking
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * The connection server handle is switched to non blocking mode and the statement
+ * is executed. If the call has not completed yet, OCI_ASYNC_PENDING is returned
+ * and OCI_ExecuteAsync() must be called again, with the same statement, until it
+ * returns another value. Blocking mode is restored once the execution completes.
+ *
+ * @note
+ * While an execution is pending, no other call can be made on the connection
+ * except OCI_Break() that cancels it. The next call to OCI_ExecuteAsync() then
+ * returns OCI_ASYNC_ERROR.
+ *
+ * @note
+ * While an execution is pending, blocking execution and fetch calls (OCI_Execute(),
+ * OCI_Parse(), OCI_FetchNext(), ...) and non blocking calls for other statements
+ * or resultsets fail with an OCI_ERR_ASYNC_PENDING error.
+ *
+ * @return
+ * - OCI_ASYNC_PENDING : the execution is still in progress
+ * - OCI_ASYNC_DONE    : the execution has completed successfully
+ * - OCI_ASYNC_ERROR   : an error occurred
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_ExecuteAsync
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Check if a non blocking execution of the given statement is pending
+ *
+ * @param stmt - Statement handle
+ *
+ * @return
+ * TRUE if OCI_ExecuteAsync() returned OCI_ASYNC_PENDING and the execution has not
+ * completed yet otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_IsExecutionPending
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Prepare and Execute a SQL statement or PL/SQL block.
@@ -4230,6 +4697,11 @@ OCI_EXPORT boolean OCI_API OCI_BindArrayOfUnsignedInts
  * parameter 'data' can NULL if the statement bind allocation mode
  * has been set to OCI_BAM_INTERNAL
  *
+ * @note
+ * With Oracle 11gR2 client and server, big integers are bound as native 8 bytes
+ * integers directly on the given buffer. Otherwise, they are converted to Oracle
+ * numbers at each execution
+ *
  * @return
  * TRUE on success otherwise FALSE
  */
@@ -4258,6 +4730,9 @@ OCI_EXPORT boolean OCI_API OCI_BindBigInt
  * parameter 'data' can NULL if the statement bind allocation mode
  * has been set to OCI_BAM_INTERNAL
  *
+ * @note
+ * See OCI_BindBigInt() about native binding of big integers
+ *
  * @return
  * TRUE on success otherwise FALSE
  */
@@ -5163,6 +5638,34 @@ OCI_EXPORT unsigned int OCI_API OCI_GetBindIndex
     const otext   *name
 );
 
+/**
+ * @brief
+ * Return a bind handle from its name without raising an error if it is not bound
+ *
+ * @param stmt - Statement handle
+ * @param name - Bind variable name
+ *
+ * @note
+ * Placeholders are collected from the SQL text when the statement is prepared.
+ * Their names are resolved without hashing and, in OCI_BIND_BY_POS mode, the
+ * position is directly used as an index
+ *
+ * @note
+ * The returned handle remains valid until the statement is prepared again.
+ * It can be kept to access the bind in O(1) before each execution
+ * instead of looking it up by name
+ *
+ * @return
+ * The bind handle or NULL if the variable is not bound
+ *
+ */
+
+OCI_EXPORT OCI_Bind * OCI_API OCI_GetBindHandle
+(
+    OCI_Statement *stmt,
+    const otext   *name
+);
+
 /**
  * @brief
  * Return the name of the given bind
@@ -5865,6 +6368,40 @@ OCI_EXPORT boolean OCI_API OCI_FetchNext
     OCI_Resultset *rs
 );
 
+/**
+ * @brief
+ * Fetch the next row of the resultset without blocking
+ *
+ * @param rs - Resultset handle
+ *
+ * @note
+ * Rows are fetched like OCI_FetchNext() does. When a new block of rows has to be
+ * fetched from the server and the call has not completed yet, OCI_ASYNC_PENDING
+ * is returned and OCI_FetchNextAsync() must be called again until it returns
+ * another value.
+ *
+ * @note
+ * While a fetch is pending, no other call can be made on the connection
+ * except OCI_Break() that cancels it. Blocking execution and fetch calls and
+ * non blocking calls for other statements or resultsets fail with an
+ * OCI_ERR_ASYNC_PENDING error.
+ *
+ * @note
+ * Resultsets using background fetching or a fetch window are fetched in blocking mode.
+ *
+ * @return
+ * - OCI_ASYNC_PENDING : the fetch is still in progress
+ * - OCI_ASYNC_DONE    : a row is available
+ * - OCI_ASYNC_NO_MORE : the last row has already been fetched
+ * - OCI_ASYNC_ERROR   : an error occurred
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_FetchNextAsync
+(
+    OCI_Resultset *rs
+);
+
 /**
  * @brief
  * Fetch the previous row of the resultset
@@ -5966,6 +6503,112 @@ OCI_EXPORT boolean OCI_API OCI_FetchSeek
     int            offset
 );
 
+/**
+ * @brief
+ * Fetch the next block of rows of the resultset
+ *
+ * @param rs    - Resultset handle
+ * @param nrows - Pointer to an unsigned int that receives the number of rows in the block
+ *
+ * @note
+ * A block is made of the rows returned by a single internal fetch, thus at most the
+ * value set with OCI_SetFetchSize() rows.
+ * Once the block is fetched, the column buffers can be accessed directly using
+ * OCI_GetColumnBlock() for the whole block without any per cell call.
+ *
+ * @note
+ * After a successful call, the current row is the last row of the block.
+ * Thus, OCI_GetXXX() calls return values of that row and a subsequent call to OCI_FetchNext()
+ * or OCI_FetchBlock() fetches the next rows from the server.
+ *
+ * @warning
+ * For regular resultsets, OCI_FetchBlock() always retrieves new rows from the server.
+ * Rows of the current block that have not been reached yet with OCI_FetchNext() are skipped.
+ *
+ * @note
+ * OCI_FetchBlock() works for normal and scrollable resultsets (moving forward only) and for
+ * resultsets from DML statements with a RETURNING INTO clause (all rows in a single block)
+ *
+ * @return
+ * TRUE on success otherwise FALSE if :
+ * - Empty resultset
+ * - Last row already fetched
+ * - An error occurred
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_FetchBlock
+(
+    OCI_Resultset *rs,
+    unsigned int  *nrows
+);
+
+/**
+ * @brief
+ * Return direct read-only access to the internal buffers of a column for the current block
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ * @param data  - Pointer that receives the address of the first element of the data array
+ * @param size  - Pointer that receives the size in bytes of one element of the data array
+ * @param inds  - Pointer that receives the address of the null indicator array
+ * @param lens  - Pointer that receives the address of the array of lengths in bytes
+ * @param lsize - Pointer that receives the size in bytes of one element of the lengths array
+ *
+ * @note
+ * Element i (starting from 0) of the current block is located at :
+ * - data : ((const char *) data) + (i * size)
+ * - null indicator : inds[i] (-1 means NULL)
+ * - length : ((const char *) lens) + (i * lsize)
+ *
+ * @note
+ * Lengths are unsigned 2 bytes integers for resultsets from SELECT statements and
+ * unsigned 4 bytes integers for resultsets from DML statements with a RETURNING INTO clause
+ *
+ * @note
+ * Any of the output parameters can be NULL
+ *
+ * @note
+ * The data array holds the Oracle client native representation of the column values :
+ * - OCI_CDT_NUMERIC : OCINumber structures when the element size is sizeof(OCINumber),
+ *   otherwise native values whose type is given by OCI_ColumnGetSubType() :
+ *     - OCI_NUM_BIGINT : big_int (NUMBER columns fetched with OCI_NDM_NATIVE, big integers
+ *       registered for a RETURNING INTO clause)
+ *     - OCI_NUM_BIGUINT : big_uint (unsigned big integers registered for a RETURNING INTO clause)
+ *     - OCI_NUM_DOUBLE : double (BINARY_DOUBLE columns, NUMBER columns fetched with OCI_NDM_NATIVE)
+ *     - OCI_NUM_FLOAT : float (BINARY_FLOAT columns)
+ * - OCI_CDT_TEXT : null terminated otext strings
+ * - OCI_CDT_RAW : raw bytes
+ * - OCI_CDT_DATETIME : OCIDate structures
+ *
+ * @warning
+ * Only columns with datatype OCI_CDT_NUMERIC, OCI_CDT_TEXT, OCI_CDT_RAW and OCI_CDT_DATETIME
+ * can be accessed this way. Other columns must be accessed using the OCI_GetXXX() functions
+ *
+ * @warning
+ * The returned pointers are only valid for the current block. They must be retrieved again
+ * after each fetch call as buffers may be swapped when background fetching is enabled
+ * (see OCI_SetBackgroundFetch())
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetColumnBlock
+(
+    OCI_Resultset         *rs,
+    unsigned int           index,
+    const void           **data,
+    unsigned int          *size,
+    const short          **inds,
+    const void           **lens,
+    unsigned int          *lsize
+);
+
 /**
  * @brief
  * Retrieve the number of rows fetched so far
@@ -6498,6 +7141,51 @@ OCI_EXPORT boolean OCI_API OCI_GetStruct
     void          *row_struct_ind
 );
 
+/**
+ * @brief
+ * Fetch the next rows of the current fetch batch into an array of row structures
+ *
+ * @param rs              - Resultset handle
+ * @param row_structs     - pointer to an array of user row structures
+ * @param row_structs_ind - pointer to an array of user indicator structures
+ * @param max_rows        - Maximum number of rows to fetch
+ *
+ * @note
+ * The rows following the current row are fetched the same way OCI_FetchNext() does
+ * and each row is copied into the array like OCI_GetStruct() does.
+ * The call stops at the end of the current internal fetch batch, thus it returns
+ * at most the value set with OCI_SetFetchSize() rows.
+ * Once returned, the current row is the last row copied into the array.
+ *
+ * @note
+ * Row structures and indicator structures follow the same rules than OCI_GetStruct().
+ * The size of each array element must be the size of the related C structure.
+ *
+ * @note
+ * The user indicator array pointer is not mandatory
+ *
+ * @warning
+ * Only resultsets with numeric, character and raw columns are supported as the other
+ * types are mapped to handles that are only valid for the current row
+ *
+ * @warning
+ * Strings and raw members point to the internal fetch buffers and are only valid until
+ * the next fetch call
+ *
+ * @return
+ * Number of rows copied into the array. 0 when the resultset has been fully fetched or
+ * if an error occurred
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetStructs
+(
+    OCI_Resultset *rs,
+    void          *row_structs,
+    void          *row_structs_ind,
+    unsigned int   max_rows
+);
+
 /**
  * @brief
  * Return the current short value of the column at the given index in the resultset
@@ -8807,22 +9495,81 @@ OCI_EXPORT boolean OCI_API OCI_ElemSetNull
  * - Statements implicitly returned from PL/SQL procedure or blocks (new feature in Oracle 12cR1) using
  *   DBMS_SQL.RETURN_RESULT()
  *
- * @note
- * SQL statements with a 'returning' clause can return multiple resultsets.
- * When arrays of program variables are binded to the statement, Oracle will
- * execute the statement for every row (iteration).
- * Each iteration generates a resultset that can be fetched like regular ones.
+ * @note
+ * SQL statements with a 'returning' clause can return multiple resultsets.
+ * When arrays of program variables are binded to the statement, Oracle will
+ * execute the statement for every row (iteration).
+ * Each iteration generates a resultset that can be fetched like regular ones.
+ *
+ * @note
+ * Starting withOracle 12cR1, PL/SQ procedure and blocks ca return multiple implicit resultsets
+ * Refer to  Oracle documentation for more information.
+ *
+ * @return
+ * A resultset handle on success otherwise NULL
+ *
+ */
+
+OCI_EXPORT OCI_Resultset * OCI_API OCI_GetNextResultset
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Set the number of rows expected to be returned by each iteration of a DML
+ * statement with a 'returning into' clause
+ *
+ * @param stmt - Statement handle
+ * @param rows - Maximum number of rows returned by each iteration
+ *
+ * @note
+ * When this value is not zero, the output buffers are sized up front for
+ * the number of iterations times the given number of rows. Oracle writes
+ * the returned values of all iterations one after the other into a single
+ * resultset, instead of one resultset per iteration.
+ * This resultset can be fetched like a query resultset, including with
+ * OCI_FetchBlock(), OCI_GetColumnBlock() and OCI_GetStructs().
+ *
+ * @note
+ * By example, an array INSERT returning generated keys returns one row per
+ * iteration and can use the value 1.
+ *
+ * @note
+ * Each iteration writes its rows into its own slot of the buffers, whatever the order
+ * in which Oracle returns them. Once the execution has completed, the rows of all
+ * iterations are gathered in iteration order at the beginning of the resultset.
+ *
+ * @warning
+ * The execution fails if an iteration returns more rows than the given value
+ *
+ * @note
+ * Default value is 0 (one resultset per iteration)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetReturningRows
+(
+    OCI_Statement *stmt,
+    unsigned int   rows
+);
+
+/**
+ * @brief
+ * Return the number of rows expected to be returned by each iteration of a DML
+ * statement with a 'returning into' clause
+ *
+ * @param stmt - Statement handle
  *
  * @note
- * Starting withOracle 12cR1, PL/SQ procedure and blocks ca return multiple implicit resultsets
- * Refer to  Oracle documentation for more information.
- *
- * @return
- * A resultset handle on success otherwise NULL
+ * See OCI_SetReturningRows()
  *
  */
 
-OCI_EXPORT OCI_Resultset * OCI_API OCI_GetNextResultset
+OCI_EXPORT unsigned int OCI_API OCI_GetReturningRows
 (
     OCI_Statement *stmt
 );
@@ -9363,6 +10110,116 @@ OCI_EXPORT unsigned int OCI_API OCI_GetFetchSize
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Enable / disable background fetching of the resultsets of a SQL statement
+ *
+ * When enabled, once a set of rows has been fetched, the next set of rows is fetched
+ * by a worker thread into alternate buffers while the application processes the
+ * current rows. When the current rows are consumed, OCI_FetchNext() just waits for the
+ * worker completion and swaps buffers.
+ * Thus, network round trips are overlapped with the application rows processing.
+ *
+ * @param stmt   - Statement handle
+ * @param enable - Enable (TRUE) or disable (FALSE)
+ *
+ * @note
+ * The mode is applied when the resultset is created. Thus it must be set before
+ * executing the statement.
+ *
+ * @note
+ * Background fetching is silently ignored (regular fetching is performed) for:
+ * - scrollable resultsets
+ * - resultsets from DML statements with a RETURNING INTO clause
+ * - resultsets holding columns that are not numeric, string, raw or date columns
+ *
+ * @warning
+ * Background fetching requires OCILIB to be initialized with OCI_ENV_THREADED mode.
+ * While the worker thread is fetching, any other call using the same connection is
+ * serialized by the Oracle client until the fetch completes
+ *
+ * @warning
+ * Background fetching doubles the memory used by the resultset internal buffers
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetBackgroundFetch
+(
+    OCI_Statement *stmt,
+    boolean        enable
+);
+
+/**
+ * @brief
+ * Return if background fetching is enabled for the given statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Default value is FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetBackgroundFetch
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Set the number of fetched row sets kept by scrollable resultsets of a SQL statement
+ *
+ * When set, each set of rows fetched from the server by a scrollable resultset is also
+ * kept in a client side window holding up to 'size' sets of rows, the least recently
+ * used one being replaced when the window is full.
+ * OCI_FetchPrev(), OCI_FetchNext(), OCI_FetchFirst(), OCI_FetchLast() and OCI_FetchSeek()
+ * moving to a row held by the window are then served locally without any server round trip.
+ *
+ * @param stmt - Statement handle
+ * @param size - Number of row sets to keep (0 to disable the window)
+ *
+ * @note
+ * The window is applied when the resultset is created. Thus it must be set before
+ * executing the statement.
+ *
+ * @note
+ * The window is silently ignored for:
+ * - non scrollable resultsets
+ * - resultsets holding columns that are not numeric, string, raw or date columns
+ *
+ * @warning
+ * Each row set kept by the window uses as much memory as the resultset internal buffers
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetFetchWindow
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the number of fetched row sets kept by scrollable resultsets of a SQL statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Default value is 0 (no window)
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetFetchWindow
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Set the number of rows pre-fetched by OCI Client
@@ -9518,6 +10375,196 @@ OCI_EXPORT unsigned int OCI_API OCI_GetLongMode
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Set the define mode of NUMBER columns of the resultsets of a SQL statement
+ *
+ * @param stmt - Statement handle
+ * @param mode - numeric define mode value
+ *
+ * @note
+ * Possible values are :
+ *
+ * - OCI_NDM_NUMBER : NUMBER columns are fetched as OCINumber and converted on each
+ *   call to OCI_GetXXX() (default)
+ * - OCI_NDM_NATIVE : NUMBER columns with a described precision are fetched directly
+ *   into native C types by the Oracle client:
+ *     - NUMBER columns with no decimals that fit in a big_int are fetched as big_int
+ *     - Other NUMBER columns with a precision up to 15 digits are fetched as double
+ *     - Other NUMBER columns (no precision or higher precision) are still fetched as OCINumber
+ *
+ * @note
+ * The mode is applied when the resultset is created. Thus it must be set before
+ * executing the statement.
+ *
+ * @note
+ * With OCI_NDM_NATIVE, the default numeric type used by OCI_GetStruct() for columns
+ * fetched as big_int or double is respectively OCI_NUM_BIGINT and OCI_NUM_DOUBLE
+ *
+ * @warning
+ * OCI_NDM_NATIVE requires Oracle 10gR1 client for double values and Oracle 11gR2 client
+ * for big_int values. Otherwise, NUMBER columns are fetched as OCINumber
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetNumericDefineMode
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+);
+
+/**
+ * @brief
+ * Return the define mode of NUMBER columns of a SQL statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ *  See OCI_SetNumericDefineMode() for possible values
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetNumericDefineMode
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Set the define mode of LOB columns of the resultsets of a SQL statement
+ *
+ * @param stmt - Statement handle
+ * @param mode - LOB define mode value
+ *
+ * @note
+ * Possible values are :
+ *
+ * - OCI_LDM_LOCATOR : LOB columns are fetched as locators and handled by OCI_Lob (default)
+ * - OCI_LDM_INLINE  : LOB columns are fetched as locators and LOB values up to the size
+ *   given by OCI_SetLobInlineSize() are prefetched with the locators within the array
+ *   fetch buffers. Reading such values does not require any extra server round trip.
+ *   Bigger values are read through their locator as with OCI_LDM_LOCATOR.
+ *
+ * @note
+ * In both modes, LOB columns are still accessed with OCI_GetLob() and their full content
+ * can be retrieved with OCI_GetString() (CLOB and NCLOB columns) or OCI_GetRaw() (BLOB columns).
+ *
+ * @note
+ * The mode is applied when the resultset is created. Thus it must be set before
+ * executing the statement.
+ *
+ * @note
+ * LOB prefetching requires Oracle 11gR1 client. With older clients, OCI_LDM_INLINE
+ * behaves like OCI_LDM_LOCATOR.
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetLobDefineMode
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+);
+
+/**
+ * @brief
+ * Return the define mode of LOB columns of a SQL statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ *  See OCI_SetLobDefineMode() for possible values
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetLobDefineMode
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Set the maximum size of LOB values fetched with OCI_LDM_INLINE define mode
+ *
+ * @param stmt - Statement handle
+ * @param size - maximum size in characters (CLOBs) or bytes (BLOBs)
+ *
+ * @note
+ * Default value is set to constant OCI_SIZE_LOB_INLINE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetLobInlineSize
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the maximum size of LOB values fetched with OCI_LDM_INLINE define mode
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Default value is set to constant OCI_SIZE_LOB_INLINE
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetLobInlineSize
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Enable or disable the reuse of the resultset when the statement is prepared again
+ *
+ * @param stmt  - Statement handle
+ * @param value - Enable/disable resultset reuse
+ *
+ * @note
+ * Re-executing a prepared SELECT statement always reuses its resultset.
+ * This option extends the reuse to statements that are prepared again with
+ * OCI_Prepare() or OCI_ExecuteStmt() and to statements bound as PL/SQL cursors.
+ * The previous resultset is kept and, if the new select list has the same
+ * columns, its define buffers are registered again instead of being freed and
+ * allocated. Only row counters and fetch status are reset.
+ *
+ * @note
+ * The resultset is not reused if the fetch size, the fetch mode, background
+ * fetching or the fetch window were changed, or if the select list contains
+ * LONG or cursor columns
+ *
+ * @note
+ * Default value is FALSE
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetResultsetReuse
+(
+    OCI_Statement *stmt,
+    boolean        value
+);
+
+/**
+ * @brief
+ * Return TRUE if the resultset is reused when the statement is prepared again
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Default value is FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetResultsetReuse
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Return the connection handle associated with a statement handle
@@ -13817,11 +14864,62 @@ OCI_EXPORT const otext * OCI_API OCI_TypeInfoGetName
  * - '%o'  : (OCI_Object *) -----> Object  (not implemented yet)
  * - '%c'  : (OCI_Coll *) -------> collection  (not implemented yet)
  *
+ * @par Binding mode
+ * By default, input values are formatted as SQL literals and each call produces
+ * a different SQL text that is hard parsed by the server.
+ * OCI_SetFormatBinding() makes the formatted functions of a connection replace
+ * the values by bind placeholders named ':1', ':2', ... in the order of the
+ * arguments and bind copies of the values, giving one SQL text per format string:
+ * - '%t' and '%p' are bound natively with OCI_BindDate() and OCI_BindTimestamp().
+ *   These objects are bound by reference and must remain valid until the statement
+ *   is executed
+ * - '%v' is bound as string
+ * - '%m' and '%r' are still formatted in the SQL text
+ * - empty or NULL strings are bound as NULL values
+ *
  * @par Example
  * @include format.c
  *
  */
 
+/**
+ * @brief
+ * Enable or disable the binding of input values by the formatted functions
+ *
+ * @param con    - Connection handle
+ * @param enable - Enable/disable binding mode
+ *
+ * @note
+ * Applies to all formatted functions called on the connection or on its statements.
+ * The bound values are owned by the statement until it is prepared again or freed.
+ *
+ * @note
+ * Default value is FALSE
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetFormatBinding
+(
+    OCI_Connection *con,
+    boolean         enable
+);
+
+/**
+ * @brief
+ * Return TRUE if the formatted functions bind their input values
+ *
+ * @param con - Connection handle
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetFormatBinding
+(
+    OCI_Connection *con
+);
+
 /**
  * @brief
  * Perform 3 calls (prepare+execute+fetch) in 1 call
@@ -14014,16 +15112,16 @@ OCI_EXPORT boolean OCI_DescribeFmt
  * @par Internal conception
  *
  * - The hash table is composed of an array of slots.
- * - Each slot can hold a linked list of entries (one per key)
+ * - Each slot can hold one entry (one per key)
  * - Each entry can hold a linked list of values
  *
  * @note
  * - The internal hash function computes the index in the array where the entry
- *   has to be inserted/looked up.
- *
+ *   has to be inserted/looked up. The hash is computed once per key and kept in the slot.
  *
  * @note
- * Collisions are handled by chaining method.
+ * Collisions are handled by open addressing (linear probing).
+ * The array of slots is doubled when it gets 3/4 full.
  *
  * @include hash.c
  *
@@ -14076,6 +15174,9 @@ OCI_EXPORT boolean OCI_API OCI_HashFree
  *
  * @param table  - Table handle
  *
+ * @note
+ * The size is the number of slots. It grows as entries are added.
+ *
  */
 
 OCI_EXPORT unsigned int OCI_API OCI_HashGetSize
@@ -14268,6 +15369,9 @@ OCI_EXPORT OCI_HashValue * OCI_API OCI_HashGetValue
  * @warning
  * Index start at at
  *
+ * @note
+ * As each slot holds at most one entry, the member next of the returned entry is always NULL
+ *
  * @return
  * Slot handle otherwise NULL
  *
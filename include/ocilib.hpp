@@ -51,6 +51,7 @@
 #include <list>
 #include <vector>
 #include <map>
+#include <stdexcept>
 
 #include "ocilib.h"
 
@@ -486,6 +487,30 @@ enum FormatTypeValues
 */
 typedef Enum<FormatTypeValues> FormatType;
 
+/**
+* @brief
+* Non blocking calls status enumerated values
+*
+*/
+enum AsyncStatusValues
+{
+    /** The call is still in progress and must be made again */
+    AsyncPending = OCI_ASYNC_PENDING,
+    /** The call has completed */
+    AsyncDone = OCI_ASYNC_DONE,
+    /** The call has completed and there is no more row to fetch */
+    AsyncNoMore = OCI_ASYNC_NO_MORE
+};
+
+/**
+* @brief
+* Non blocking calls status
+*
+* Possible values are AsyncStatusValues
+*
+*/
+typedef Enum<AsyncStatusValues> AsyncStatus;
+
 /**
  *
  * @brief
@@ -697,7 +722,9 @@ public:
 		/** Enable support for multi-threading */
 		Threaded  = OCI_ENV_THREADED,
 		/** Enable support for events related to subscriptions, HA and AQ notifications */
-		Events = OCI_ENV_EVENTS
+		Events = OCI_ENV_EVENTS,
+		/** Record memory statistics */
+		MemoryStats = OCI_ENV_MEMORY_STATS
 	};
 
 	/**
@@ -1632,6 +1659,54 @@ public:
      *
      */
     void SetStatementCacheSize(unsigned int value);
+
+    /**
+     * @brief
+     * Execute a SELECT statement in parallel partitions, each one fetched from its own
+     * pool connection within its own thread
+     *
+     * @tparam TFetchCallback - type of the callback
+     *
+     * @param sql        - SELECT statement to execute
+     * @param key        - Expression on the columns of the statement used to partition the rows
+     * @param partitions - Number of partitions
+     * @param callback   - Callback called for each fetched row
+     *
+     * @note
+     * The callback must have the signature "bool callback(const Resultset &rs, unsigned int partition)"
+     * and return true to continue fetching the partition or false to stop it
+     *
+     * @note
+     * The callback is called concurrently from the worker threads
+     *
+     * @note
+     * The first Exception thrown by the callback or raised by a partition is thrown once
+     * all partitions are completed
+     *
+     * @return
+     * The total number of rows fetched
+     *
+     * @warning
+     * Requires Environment::Threaded mode.
+     * See OCI_PoolExecuteParallel() for more details about partitioning
+     *
+     */
+    template<class TFetchCallback>
+    unsigned int ExecuteParallel(const ostring& sql, const ostring& key, unsigned int partitions, TFetchCallback callback);
+
+private:
+
+    template<class TFetchCallback>
+    struct PartitionContext
+    {
+        TFetchCallback            *callback;
+        std::vector<Resultset *>   resultsets;
+        std::vector<Exception *>   errors;
+        std::vector<unsigned int>  rows;
+    };
+
+    template<class TFetchCallback>
+    static unsigned int PartitionFetch(OCI_Resultset *pResultset, unsigned int partition, void *arg);
 };
 
 /**
@@ -5292,6 +5367,50 @@ public:
 	*/
     typedef Enum<LongModeValues> LongMode;
 
+	/**
+	* @brief
+	* NUMBER columns define modes enumerated values
+	*
+	*/
+    enum NumericDefineModeValues
+    {
+		/** NUMBER columns are fetched as OCINumber */
+        NumericDefineNumber = OCI_NDM_NUMBER,
+		/** NUMBER columns with a known precision are fetched as native big_int or double */
+		NumericDefineNative = OCI_NDM_NATIVE
+    };
+
+	/**
+	* @brief
+	* NUMBER columns define modes
+	*
+	* Possible values are Statement::NumericDefineModeValues
+	*
+	*/
+    typedef Enum<NumericDefineModeValues> NumericDefineMode;
+
+	/**
+	* @brief
+	* LOB columns define modes enumerated values
+	*
+	*/
+    enum LobDefineModeValues
+    {
+		/** LOB columns are fetched as locators (Lob objects) */
+        LobDefineLocator = OCI_LDM_LOCATOR,
+		/** LOB columns are fetched as locators with values up to the inline size prefetched */
+		LobDefineInline = OCI_LDM_INLINE
+    };
+
+	/**
+	* @brief
+	* LOB columns define modes
+	*
+	* Possible values are Statement::LobDefineModeValues
+	*
+	*/
+    typedef Enum<LobDefineModeValues> LobDefineMode;
+
     /**
     * @brief
     * Create an empty null Statement instance
@@ -5448,6 +5567,56 @@ public:
     template<class TAdapter, class TFetchCallback>
     unsigned int ExecutePrepared(TFetchCallback callback, TAdapter adapter);
 
+    /**
+    * @brief
+    * Execute the prepared array DML statement over an input of any size
+    *
+    * @tparam TFillCallback - type of the fill callback
+    *
+    * @param callback - User defined callback filling the bound vectors
+    *
+    * @note
+    * The user defined callback function must conform to the following prototype:
+    * bool callback(unsigned int index)
+    * It shall set the bound vectors elements at the given index and return true
+    * or return false once the input is exhausted
+    *
+    * @note
+    * The bound vectors are used as chunk buffers of GetBindArraySize() elements.
+    * Rejected rows of all chunks are returned by GetBatchErrors()
+    *
+    * @note
+    * An exception thrown by the callback stops the execution, the rows of the
+    * current chunk are not executed, and it is rethrown by ExecuteChunked().
+    * Exceptions that are not ocilib::Exception objects are rethrown as
+    * std::runtime_error exceptions carrying the same message
+    *
+    * @return
+    * The number of rows processed
+    *
+    */
+    template<class TFillCallback>
+    unsigned int ExecuteChunked(TFillCallback callback);
+
+    /**
+    * @brief
+    * Execute or resume the execution of the prepared statement without blocking
+    *
+    * @note
+    * Each call performs a single non blocking step and returns immediately.
+    * While it returns AsyncPending, it must be called again, with no other call made
+    * on the statement connection meanwhile, until it returns AsyncDone.
+    *
+    * @note
+    * A pending execution can be cancelled with Connection::Break(). The next call
+    * then throws the exception reported by the server
+    *
+    * @return
+    * AsyncPending or AsyncDone
+    *
+    */
+    AsyncStatus ExecuteAsync();
+
     /**
     * @brief
     * Execute the given SQL statement, retrieve all resultsets, and call the given callback for each row of each resultsets
@@ -5743,10 +5912,36 @@ public:
 	* It is not necessary to specify the template data type in the bind call as all possible specializations can be resolved
 	* automatically from the arguments.
 	*
+	* @note
+	* For C++ native numeric types, the vector storage is bound directly without any copy when the vector
+	* holds at least as many elements as the current bind array size. Otherwise, values are copied into an
+	* internal buffer. If the vector storage is reallocated between executions, the bind is updated automatically.
+	*
 	*/
     template <class TDataType>
     void Bind(const ostring& name, std::vector<TDataType> &values, BindInfo::BindDirection mode);
 
+	/**
+	* @brief
+	* Bind an array of host variables managed by the caller
+	*
+	* @tparam TDataType - C++ type of the host variables
+	*
+	* @param name   - Bind name
+	* @param values - Pointer to the first element of the array
+	* @param mode   - bind direction mode
+	*
+	* @warning
+	* This method has built-in specialized versions for all C++ native numeric types.
+	*
+	* @note
+	* The array is bound directly without any copy. It must hold at least SetBindArraySize() elements and remain
+	* valid until the statement is executed for the last time or its binds are cleared.
+	*
+	*/
+    template <class TDataType>
+    void Bind(const ostring& name, TDataType *values, BindInfo::BindDirection mode);
+
 	/**
 	* @brief
 	* Bind a vector of host variables with Oracle type information
@@ -5951,6 +6146,47 @@ public:
 	*/
     unsigned int GetFetchSize() const;
 
+	/**
+	* @brief
+	* Enable / disable background fetching of the statement resultsets
+	*
+	* @param value - enable (true) or disable (false)
+	*
+	* @note
+	* See OCI_SetBackgroundFetch() for details
+	*
+	*/
+    void SetBackgroundFetch(bool value);
+
+	/**
+	* @brief
+	* Return true if background fetching is enabled
+	*
+	*/
+    bool GetBackgroundFetch() const;
+
+	/**
+	* @brief
+	* Set the number of fetched row sets kept by scrollable resultsets
+	*
+	* @param value - number of row sets (0 to disable)
+	*
+	* @note
+	* See OCI_SetFetchWindow() for details
+	*
+	*/
+    void SetFetchWindow(unsigned int value);
+
+	/**
+	* @brief
+	* Return the number of fetched row sets kept by scrollable resultsets
+	*
+	* @note
+	* Default value is 0 (no window)
+	*
+	*/
+    unsigned int GetFetchWindow() const;
+
 	/**
 	* @brief
 	* Set the number of rows pre-fetched by OCI Client
@@ -6041,6 +6277,114 @@ public:
 	*/
     LongMode GetLongMode() const;
 
+	/**
+	* @brief
+	* Set the define mode of NUMBER columns of the resultsets of a SQL statement
+	*
+	* @param value - numeric define mode value
+	*
+	* @note
+	* It must be set before executing the statement
+	*
+	*/
+    void SetNumericDefineMode(NumericDefineMode value);
+
+	/**
+	* @brief
+	* Return the define mode of NUMBER columns of a SQL statement
+	*
+	*/
+    NumericDefineMode GetNumericDefineMode() const;
+
+	/**
+	* @brief
+	* Set the define mode of LOB columns of the resultsets of a SQL statement
+	*
+	* @param value - LOB define mode value
+	*
+	* @note
+	* It must be set before executing the statement
+	*
+	* @note
+	* With Statement::LobDefineInline, values up to the inline size are prefetched with their
+	* locators and bigger values are read through their locators
+	*
+	*/
+    void SetLobDefineMode(LobDefineMode value);
+
+	/**
+	* @brief
+	* Return the define mode of LOB columns of a SQL statement
+	*
+	*/
+    LobDefineMode GetLobDefineMode() const;
+
+	/**
+	* @brief
+	* Set the maximum size of LOB values fetched with Statement::LobDefineInline mode
+	*
+	* @param value - maximum size in characters (CLOBs) or bytes (BLOBs)
+	*
+	* @note
+	* Default value is set to constant OCI_SIZE_LOB_INLINE
+	*
+	*/
+    void SetLobInlineSize(unsigned int value);
+
+	/**
+	* @brief
+	* Return the maximum size of LOB values fetched with Statement::LobDefineInline mode
+	*
+	*/
+    unsigned int GetLobInlineSize() const;
+
+	/**
+	* @brief
+	* Enable or disable the reuse of the resultset when the statement is prepared again
+	*
+	* @param value - Enable/disable resultset reuse
+	*
+	* @note
+	* See OCI_SetResultsetReuse() for the conditions of the reuse
+	*
+	* @note
+	* Default value is false
+	*
+	*/
+    void SetResultsetReuse(bool value);
+
+	/**
+	* @brief
+	* Return true if the resultset is reused when the statement is prepared again
+	*
+	*/
+    bool GetResultsetReuse() const;
+
+	/**
+	* @brief
+	* Set the number of rows expected to be returned by each iteration
+	* of a DML statement with a 'returning into' clause
+	*
+	* @param value - Maximum number of rows returned by each iteration
+	*
+	* @note
+	* When not zero, all iterations return their rows into a single resultset
+	* preallocated up front. See OCI_SetReturningRows()
+	*
+	* @note
+	* Default value is 0
+	*
+	*/
+    void SetReturningRows(unsigned int value);
+
+	/**
+	* @brief
+	* Return the number of rows expected to be returned by each iteration
+	* of a DML statement with a 'returning into' clause
+	*
+	*/
+    unsigned int GetReturningRows() const;
+
 	/**
 	* @brief
 	* Return the Oracle SQL code the command held by the statement
@@ -6104,6 +6448,22 @@ private:
     template <typename TBindMethod, class TObjectType, class TDataType, class TElemType>
     void Bind (TBindMethod &method, const ostring& name, std::vector<TObjectType> &values, BindValue<TDataType> datatype, BindInfo::BindDirection mode, TElemType type);
 
+    template <class TDataType>
+    void BindDirect (typename BindVector<TDataType>::BindMethod method, const ostring& name, std::vector<TDataType> &values, BindInfo::BindDirection mode);
+
+    template<class TFillCallback>
+    struct ChunkContext
+    {
+        Statement      *statement;
+        TFillCallback  *callback;
+        Exception      *error;
+        bool            failed;
+        std::string     failure;
+    };
+
+    template<class TFillCallback>
+    static unsigned int ChunkFill(OCI_Statement *pStatement, unsigned int size, void *arg);
+
     template<typename TFetchCallback>
     unsigned int Fetch(TFetchCallback callback);
 
@@ -6121,6 +6481,7 @@ private:
 class Resultset : public HandleHolder<OCI_Resultset *>
 {
     friend class Statement;
+    friend class Pool;
 public:
 
 	/**
@@ -6279,6 +6640,26 @@ public:
 	*/
     bool Next();
 
+    /**
+    * @brief
+    * Fetch or resume the fetch of the next row of the resultset without blocking
+    *
+    * @note
+    * Each call performs a single non blocking step and returns immediately.
+    * While it returns AsyncPending, it must be called again, with no other call made
+    * on the statement connection meanwhile, until it returns another value.
+    *
+    * @note
+    * A pending fetch can be cancelled with Connection::Break()
+    *
+    * @return
+    * - AsyncPending : the fetch is still in progress
+    * - AsyncDone    : a row is available
+    * - AsyncNoMore  : empty resultset or last row already fetched
+    *
+    */
+    AsyncStatus NextAsync();
+
 	/**
 	* @brief
 	* Fetch the previous row of the resultset
@@ -497,6 +497,33 @@ private:
     AbstractBindArrayObject * _object;
 };
 
+template <class TDataType>
+class BindVector : public BindObject
+{
+public:
+
+    typedef boolean (OCI_API *BindMethod)(OCI_Statement *, const otext *, TDataType *, unsigned int);
+
+	BindVector(const Statement &statement, const ostring& name, std::vector<TDataType> &vector, BindMethod method, unsigned int mode);
+	virtual ~BindVector();
+
+	void Attach();
+
+	void SetInData();
+	void SetOutData();
+
+private:
+
+    TDataType * GetTarget();
+
+    std::vector<TDataType> & _vector;
+    TDataType *  _buffer;
+    TDataType *  _data;
+    BindMethod   _method;
+    unsigned int _mode;
+    unsigned int _elemCount;
+};
+
 template <class TNativeType, class TObjectType>
 class BindAdaptor : public BindObject
 {
@@ -1301,6 +1301,85 @@ inline void Pool::SetStatementCacheSize(unsigned int value)
     Check( OCI_PoolSetStatementCacheSize(*this, value));
 }
 
+template<class TFetchCallback>
+inline unsigned int Pool::ExecuteParallel(const ostring& sql, const ostring& key, unsigned int partitions, TFetchCallback callback)
+{
+    PartitionContext<TFetchCallback> context;
+
+    context.callback = &callback;
+    context.resultsets.resize(partitions);
+    context.errors.resize(partitions);
+    context.rows.resize(partitions);
+
+    boolean res = OCI_PoolExecuteParallel(*this, sql.c_str(), key.c_str(), partitions,
+                                          PartitionFetch<TFetchCallback>, &context);
+
+    unsigned int count = 0;
+    Exception *error = 0;
+
+    for (unsigned int i = 0; i < partitions; i++)
+    {
+        delete context.resultsets[i];
+
+        count += context.rows[i];
+
+        if (!error)
+        {
+            error = context.errors[i];
+        }
+        else
+        {
+            delete context.errors[i];
+        }
+    }
+
+    if (error)
+    {
+        Exception copy(*error);
+        delete error;
+        throw copy;
+    }
+
+    Check(res);
+
+    return count;
+}
+
+template<class TFetchCallback>
+inline unsigned int Pool::PartitionFetch(OCI_Resultset *pResultset, unsigned int partition, void *arg)
+{
+    PartitionContext<TFetchCallback> *context = static_cast<PartitionContext<TFetchCallback> *>(arg);
+
+    unsigned int res = FALSE;
+
+    /* exceptions must not go through the worker threads created by the C API */
+
+    try
+    {
+        Resultset *rs = context->resultsets[partition];
+
+        if (!rs)
+        {
+            rs = new Resultset(pResultset, 0);
+            context->resultsets[partition] = rs;
+        }
+
+        context->rows[partition]++;
+
+        res = (*context->callback)(static_cast<const Resultset&>(*rs), partition) ? TRUE : FALSE;
+    }
+    catch (Exception &e)
+    {
+        context->errors[partition] = new Exception(e);
+    }
+    catch (...)
+    {
+        /* other exceptions stop the partition */
+    }
+
+    return res;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * Connection
  * --------------------------------------------------------------------------------------------- */
@@ -4258,6 +4337,117 @@ inline BindAdaptor<TNativeType, TObjectType>::operator TNativeType *()  const
     return _data;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * BindVector
+ * --------------------------------------------------------------------------------------------- */
+
+template <class TDataType>
+inline BindVector<TDataType>::BindVector(const Statement &statement, const ostring& name, std::vector<TDataType> &vector, BindMethod method, unsigned int mode)
+    : BindObject(statement, name), _vector(vector), _buffer(0), _data(0), _method(method), _mode(mode), _elemCount(statement.GetBindArraySize())
+{
+}
+
+template <class TDataType>
+inline BindVector<TDataType>::~BindVector()
+{
+    delete [] _buffer;
+}
+
+template <class TDataType>
+inline TDataType * BindVector<TDataType>::GetTarget()
+{
+    /* the vector storage is bound directly when it holds enough elements for the
+       current execution, otherwise its values are copied into an internal buffer */
+
+    if (_vector.size() >= Check(OCI_BindArrayGetSize(_pStatement)))
+    {
+        return &_vector[0];
+    }
+
+    if (!_buffer)
+    {
+        _buffer = new TDataType[_elemCount];
+
+        memset(_buffer, 0, _elemCount * sizeof(TDataType));
+    }
+
+    return _buffer;
+}
+
+template <class TDataType>
+inline void BindVector<TDataType>::Attach()
+{
+    TDataType *data = GetTarget();
+
+    if (data != _data)
+    {
+        /* the vector storage has been reallocated or resized since the last execution,
+           thus the bind must point to the new location */
+
+        boolean reuse = Check(OCI_IsRebindingAllowed(_pStatement));
+
+        if (_data)
+        {
+            Check(OCI_AllowRebinding(_pStatement, TRUE));
+        }
+
+        try
+        {
+            Check(_method(_pStatement, _name.c_str(), data, 0));
+
+            if (_data)
+            {
+                Check(OCI_BindSetDirection(Check(OCI_GetBind2(_pStatement, _name.c_str())), _mode));
+            }
+        }
+        catch (...)
+        {
+            OCI_AllowRebinding(_pStatement, reuse);
+            throw;
+        }
+
+        Check(OCI_AllowRebinding(_pStatement, reuse));
+
+        _data = data;
+    }
+}
+
+template <class TDataType>
+inline void BindVector<TDataType>::SetInData()
+{
+    Attach();
+
+    if ((_data == _buffer) && (_mode & OCI_BDM_IN))
+    {
+        typename std::vector<TDataType>::iterator it, it_end;
+
+        unsigned int index = 0;
+        unsigned int currElemCount = Check(OCI_BindArrayGetSize(_pStatement));
+
+        for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+        {
+            _data[index] = *it;
+        }
+    }
+}
+
+template <class TDataType>
+inline void BindVector<TDataType>::SetOutData()
+{
+    if ((_data == _buffer) && (_mode & OCI_BDM_OUT))
+    {
+        typename std::vector<TDataType>::iterator it, it_end;
+
+        unsigned int index = 0;
+        unsigned int currElemCount = Check(OCI_BindArrayGetSize(_pStatement));
+
+        for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+        {
+            *it = _data[index];
+        }
+    }
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * BindsHolder
  * --------------------------------------------------------------------------------------------- */
@@ -4463,6 +4653,103 @@ inline unsigned int Statement::ExecutePrepared(TFetchCallback callback, TAdapter
     return Fetch(callback, adapter);
 }
 
+template<class TFillCallback>
+inline unsigned int Statement::ExecuteChunked(TFillCallback callback)
+{
+    ChunkContext<TFillCallback> context;
+
+    context.statement = this;
+    context.callback  = &callback;
+    context.error     = 0;
+    context.failed    = false;
+
+    ReleaseResultsets();
+
+    boolean res = OCI_ExecuteChunked(*this, ChunkFill<TFillCallback>, &context);
+
+    /* exceptions thrown by the callback are rethrown once back from the C API */
+
+    if (context.error)
+    {
+        Exception copy(*context.error);
+        delete context.error;
+        throw copy;
+    }
+
+    if (context.failed)
+    {
+        throw std::runtime_error(context.failure);
+    }
+
+    Check(res);
+
+    return GetAffectedRows();
+}
+
+inline AsyncStatus Statement::ExecuteAsync()
+{
+    /* binds are set up only when starting the execution, not when resuming it */
+
+    if (!Check(OCI_IsExecutionPending(*this)))
+    {
+        ReleaseResultsets();
+        SetInData();
+    }
+
+    AsyncStatus status(static_cast<AsyncStatus::type>(Check(OCI_ExecuteAsync(*this))));
+
+    if (status == AsyncDone)
+    {
+        SetOutData();
+    }
+
+    return status;
+}
+
+template<class TFillCallback>
+inline unsigned int Statement::ChunkFill(OCI_Statement *pStatement, unsigned int size, void *arg)
+{
+    ARG_NOT_USED(pStatement);
+
+    ChunkContext<TFillCallback> *context = static_cast<ChunkContext<TFillCallback> *>(arg);
+
+    unsigned int count = 0;
+
+    /* exceptions must not go through the C API : they are stored and the input is ended */
+
+    try
+    {
+        while (count < size && (*context->callback)(count))
+        {
+            count++;
+        }
+
+        if (count > 0)
+        {
+            context->statement->SetInData();
+        }
+    }
+    catch (Exception &e)
+    {
+        context->error = new Exception(e);
+        count = 0;
+    }
+    catch (std::exception &e)
+    {
+        context->failed  = true;
+        context->failure = e.what();
+        count = 0;
+    }
+    catch (...)
+    {
+        context->failed  = true;
+        context->failure = "Unknown exception thrown by the chunk fill callback";
+        count = 0;
+    }
+
+    return count;
+}
+
 inline void Statement::Execute(const ostring& sql)
 {
     ClearBinds();
@@ -4642,6 +4929,26 @@ inline void Statement::Bind (TBindMethod &method, const ostring& name, std::vect
     Check(res);
 }
 
+template <class TDataType>
+inline void Statement::BindDirect (typename BindVector<TDataType>::BindMethod method, const ostring& name, std::vector<TDataType> &values, BindInfo::BindDirection mode)
+{
+    BindVector<TDataType> * bnd = new BindVector<TDataType>(*this, name, values, method, mode);
+
+    try
+    {
+        bnd->Attach();
+    }
+    catch (...)
+    {
+        delete bnd;
+        throw;
+    }
+
+    BindsHolder *bindsHolder = GetBindsHolder(true);
+    bindsHolder->AddBindObject(bnd);
+    SetLastBindMode(mode);
+}
+
 template <>
 inline void Statement::Bind<short>(const ostring& name, short &value, BindInfo::BindDirection mode)
 {
@@ -4847,49 +5154,105 @@ inline void Statement::Bind<Raw, int>(const ostring& name, Raw &value,  int maxS
 template <>
 inline void Statement::Bind<short>(const ostring& name, std::vector<short> &values, BindInfo::BindDirection mode)
 {
-    Bind(OCI_BindArrayOfShorts, name, values, BindValue<short>(), mode);
+    BindDirect(OCI_BindArrayOfShorts, name, values, mode);
 }
 
 template <>
 inline void Statement::Bind<unsigned short>(const ostring& name, std::vector<unsigned short> &values, BindInfo::BindDirection mode)
 {
-    Bind(OCI_BindArrayOfUnsignedShorts, name, values, BindValue<unsigned short>(), mode);
+    BindDirect(OCI_BindArrayOfUnsignedShorts, name, values, mode);
 }
 
 template <>
 inline void Statement::Bind<int>(const ostring& name, std::vector<int> &values, BindInfo::BindDirection mode)
 {
-    Bind(OCI_BindArrayOfInts, name, values, BindValue<int>(), mode);
+    BindDirect(OCI_BindArrayOfInts, name, values, mode);
 }
 
 template <>
 inline void Statement::Bind<unsigned int>(const ostring& name, std::vector<unsigned int> &values, BindInfo::BindDirection mode)
 {
-    Bind(OCI_BindArrayOfUnsignedInts, name, values, BindValue<unsigned int>(), mode);
+    BindDirect(OCI_BindArrayOfUnsignedInts, name, values, mode);
 }
 
 template <>
 inline void Statement::Bind<big_int>(const ostring& name, std::vector<big_int> &values, BindInfo::BindDirection mode)
 {
-    Bind(OCI_BindArrayOfBigInts, name, values, BindValue<big_int>(), mode);
+    BindDirect(OCI_BindArrayOfBigInts, name, values, mode);
 }
 
 template <>
 inline void Statement::Bind<big_uint>(const ostring& name, std::vector<big_uint> &values, BindInfo::BindDirection mode)
 {
-    Bind(OCI_BindArrayOfUnsignedBigInts, name, values, BindValue<big_uint>(), mode);
+    BindDirect(OCI_BindArrayOfUnsignedBigInts, name, values, mode);
 }
 
 template <>
 inline void Statement::Bind<float>(const ostring& name, std::vector<float> &values, BindInfo::BindDirection mode)
 {
-    Bind(OCI_BindArrayOfFloats, name, values, BindValue<float>(), mode);
+    BindDirect(OCI_BindArrayOfFloats, name, values, mode);
 }
 
 template <>
 inline void Statement::Bind<double>(const ostring& name, std::vector<double> &values, BindInfo::BindDirection mode)
 {
-    Bind(OCI_BindArrayOfDoubles, name, values, BindValue<double>(), mode);
+    BindDirect(OCI_BindArrayOfDoubles, name, values, mode);
+}
+
+template <>
+inline void Statement::Bind<short>(const ostring& name, short *values, BindInfo::BindDirection mode)
+{
+    Check(OCI_BindArrayOfShorts(*this, name.c_str(), values, 0));
+    SetLastBindMode(mode);
+}
+
+template <>
+inline void Statement::Bind<unsigned short>(const ostring& name, unsigned short *values, BindInfo::BindDirection mode)
+{
+    Check(OCI_BindArrayOfUnsignedShorts(*this, name.c_str(), values, 0));
+    SetLastBindMode(mode);
+}
+
+template <>
+inline void Statement::Bind<int>(const ostring& name, int *values, BindInfo::BindDirection mode)
+{
+    Check(OCI_BindArrayOfInts(*this, name.c_str(), values, 0));
+    SetLastBindMode(mode);
+}
+
+template <>
+inline void Statement::Bind<unsigned int>(const ostring& name, unsigned int *values, BindInfo::BindDirection mode)
+{
+    Check(OCI_BindArrayOfUnsignedInts(*this, name.c_str(), values, 0));
+    SetLastBindMode(mode);
+}
+
+template <>
+inline void Statement::Bind<big_int>(const ostring& name, big_int *values, BindInfo::BindDirection mode)
+{
+    Check(OCI_BindArrayOfBigInts(*this, name.c_str(), values, 0));
+    SetLastBindMode(mode);
+}
+
+template <>
+inline void Statement::Bind<big_uint>(const ostring& name, big_uint *values, BindInfo::BindDirection mode)
+{
+    Check(OCI_BindArrayOfUnsignedBigInts(*this, name.c_str(), values, 0));
+    SetLastBindMode(mode);
+}
+
+template <>
+inline void Statement::Bind<float>(const ostring& name, float *values, BindInfo::BindDirection mode)
+{
+    Check(OCI_BindArrayOfFloats(*this, name.c_str(), values, 0));
+    SetLastBindMode(mode);
+}
+
+template <>
+inline void Statement::Bind<double>(const ostring& name, double *values, BindInfo::BindDirection mode)
+{
+    Check(OCI_BindArrayOfDoubles(*this, name.c_str(), values, 0));
+    SetLastBindMode(mode);
 }
 
 template <>
@@ -5205,6 +5568,26 @@ inline unsigned int Statement::GetFetchSize() const
    return Check(OCI_GetFetchSize(*this));
 }
 
+inline void Statement::SetBackgroundFetch(bool value)
+{
+    Check(OCI_SetBackgroundFetch(*this, value));
+}
+
+inline bool Statement::GetBackgroundFetch() const
+{
+    return (Check(OCI_GetBackgroundFetch(*this)) == TRUE);
+}
+
+inline void Statement::SetFetchWindow(unsigned int value)
+{
+    Check(OCI_SetFetchWindow(*this, value));
+}
+
+inline unsigned int Statement::GetFetchWindow() const
+{
+    return Check(OCI_GetFetchWindow(*this));
+}
+
 inline void Statement::SetPrefetchSize(unsigned int value)
 {
     Check(OCI_SetPrefetchSize(*this, value));
@@ -5245,6 +5628,56 @@ inline Statement::LongMode Statement::GetLongMode() const
 	return LongMode(static_cast<LongMode::type>(Check(OCI_GetLongMode(*this))));
 }
 
+inline void Statement::SetNumericDefineMode(NumericDefineMode value)
+{
+    Check(OCI_SetNumericDefineMode(*this, value));
+}
+
+inline Statement::NumericDefineMode Statement::GetNumericDefineMode() const
+{
+	return NumericDefineMode(static_cast<NumericDefineMode::type>(Check(OCI_GetNumericDefineMode(*this))));
+}
+
+inline void Statement::SetLobDefineMode(LobDefineMode value)
+{
+    Check(OCI_SetLobDefineMode(*this, value));
+}
+
+inline Statement::LobDefineMode Statement::GetLobDefineMode() const
+{
+	return LobDefineMode(static_cast<LobDefineMode::type>(Check(OCI_GetLobDefineMode(*this))));
+}
+
+inline void Statement::SetLobInlineSize(unsigned int value)
+{
+    Check(OCI_SetLobInlineSize(*this, value));
+}
+
+inline unsigned int Statement::GetLobInlineSize() const
+{
+    return Check(OCI_GetLobInlineSize(*this));
+}
+
+inline void Statement::SetResultsetReuse(bool value)
+{
+    Check(OCI_SetResultsetReuse(*this, static_cast<boolean>(value)));
+}
+
+inline bool Statement::GetResultsetReuse() const
+{
+    return (Check(OCI_GetResultsetReuse(*this)) == TRUE);
+}
+
+inline void Statement::SetReturningRows(unsigned int value)
+{
+    Check(OCI_SetReturningRows(*this, value));
+}
+
+inline unsigned int Statement::GetReturningRows() const
+{
+    return Check(OCI_GetReturningRows(*this));
+}
+
 inline unsigned int Statement::GetSQLCommand() const
 {
     return Check(OCI_GetSQLCommand(*this));
@@ -5358,6 +5791,11 @@ inline bool Resultset::Next()
     return (Check(OCI_FetchNext(*this)) == TRUE);
 }
 
+inline AsyncStatus Resultset::NextAsync()
+{
+    return AsyncStatus(static_cast<AsyncStatus::type>(Check(OCI_FetchNextAsync(*this))));
+}
+
 inline bool Resultset::Prev()
 {
     return (Check(OCI_FetchPrev(*this)) == TRUE);
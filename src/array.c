@@ -267,7 +267,8 @@ OCI_Array * OCI_ArrayCreate
     if (!res)
     {
         OCI_ArrayClose(arr);
-        OCI_FREE(arr)
+        OCI_ListRemove(OCILib.arrs, arr);
+        arr = NULL;
     }
 
     return arr;
@@ -316,9 +317,8 @@ boolean OCI_ArrayFreeFromHandles
 
     if (arr)
     {
-        res = OCI_ListRemove(OCILib.arrs, arr);
         OCI_ArrayClose(arr);
-        OCI_FREE(arr)
+        res = OCI_ListRemove(OCILib.arrs, arr);
     }
 
     return res;
@@ -100,12 +100,62 @@ boolean OCI_BindFree
     OCI_FREE(bnd->buffer.lens)
     OCI_FREE(bnd->buffer.tmpbuf)
     OCI_FREE(bnd->plrcds)
-    OCI_FREE(bnd->name)
-    OCI_FREE(bnd)
+
+    /* the bind structure and its name belong to the statement arena */
 
     return res;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BindSetPlan
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_BindSetPlan
+(
+    OCI_Bind *bnd
+)
+{
+    OCI_CHECK(NULL == bnd, FALSE)
+
+    bnd->plan = OCI_BPL_NONE;
+
+    if (OCI_CDT_CURSOR == bnd->type)
+    {
+        bnd->plan |= OCI_BPL_CURSOR;
+    }
+
+    if (bnd->direction & OCI_BDM_IN)
+    {
+        if (OCI_CDT_TEXT == bnd->type)
+        {
+            bnd->plan |= OCI_BPL_LENGTHS;
+        }
+
+        /* big integers and internal allocated buffers need a conversion or a copy
+           of the input values */
+
+        if (((OCI_CDT_NUMERIC == bnd->type) && (SQLT_VNU == bnd->code)) || bnd->alloc)
+        {
+            bnd->plan |= OCI_BPL_CONVERT;
+        }
+
+        if ((OCI_CDT_NUMERIC != bnd->type) &&
+            (OCI_CDT_TEXT    != bnd->type) &&
+            (OCI_CDT_RAW     != bnd->type) &&
+            (OCI_CDT_OBJECT  != bnd->type))
+        {
+            bnd->plan |= OCI_BPL_NULLS;
+        }
+
+        if (OCI_CDT_OBJECT == bnd->type)
+        {
+            bnd->plan |= OCI_BPL_OBJECT;
+        }
+    }
+
+    return TRUE;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_BindAllocData
  * --------------------------------------------------------------------------------------------- */
@@ -594,6 +644,7 @@ boolean OCI_API OCI_BindSetDataSizeAtPos
         }
 
         ((ub2 *) bnd->buffer.lens)[position-1] = (ub2) size;
+        bnd->dirty = TRUE;
 
         call_retval = TRUE;
     }
@@ -812,7 +863,7 @@ boolean OCI_API OCI_BindSetDirection
 
     bnd->direction = (ub1) direction;
 
-    call_retval = call_status = TRUE;
+    call_retval = call_status = OCI_BindSetPlan(bnd);
 
     OCI_LIB_CALL_EXIT()
 }
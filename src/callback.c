@@ -118,6 +118,7 @@ sb4 OCI_ProcOutBind
     OCI_Resultset *rs   = NULL;
     boolean        res  = TRUE;
     ub4            rows = 0;
+    ub4            row  = index;
 
     /* those checks may be not necessary but they keep away compilers warning
        away if the warning level is set to maximum !
@@ -138,7 +139,7 @@ sb4 OCI_ProcOutBind
 
     if (0 == index)
     {
-        bnd->stmt->nb_rs  = bnd->stmt->nb_iters;
+        bnd->stmt->nb_rs  = bnd->stmt->ret_rows ? 1 : bnd->stmt->nb_iters;
         bnd->stmt->cur_rs = 0;
 
         /* allocate resultset handles array */
@@ -155,9 +156,56 @@ sb4 OCI_ProcOutBind
             }
         }
 
+        if (res && bnd->stmt->ret_rows)
+        {
+            OCI_Statement *stmt = bnd->stmt;
+
+            /* preallocated mode : each iteration writes its rows into its own slot of
+               ret_rows rows within the buffers of a single resultset sized up front,
+               whatever the order of the callbacks. The rows of all slots are packed
+               once the execution has completed */
+
+            if (!stmt->rsts[0])
+            {
+                stmt->rsts[0] = OCI_ResultsetCreate(stmt, (int) (stmt->nb_iters * stmt->ret_rows));
+
+                res = (NULL != stmt->rsts[0]);
+            }
+
+            if (res && !stmt->ret_counts)
+            {
+                stmt->ret_counts = (ub4 *) OCI_MemAlloc(OCI_IPC_LEN_ARRAY, sizeof(*stmt->ret_counts),
+                                                        (size_t) stmt->nb_iters, TRUE);
+
+                res = (NULL != stmt->ret_counts);
+            }
+
+            OCI_CALL1
+            (
+                res, stmt->con, stmt,
+
+                OCIAttrGet(bnd->buffer.handle, (ub4) OCI_HTYPE_BIND, (void *) &rows, (ub4 *) NULL,
+                           (ub4) OCI_ATTR_ROWS_RETURNED, stmt->con->err)
+            )
+
+            if (res)
+            {
+                if ((rows > stmt->ret_rows) || (iter >= stmt->nb_iters))
+                {
+                    OCI_ExceptionOutOfBounds(stmt->con, (int) rows);
+
+                    res = FALSE;
+                }
+                else
+                {
+                    stmt->ret_counts[iter] = rows;
+                }
+            }
+        }
+
         /* create resultset as needed */
 
-        if (res && !bnd->stmt->rsts[iter])
+        else if (res && !bnd->stmt->rsts[iter])
         {
             OCI_CALL1
             (
@@ -181,7 +229,17 @@ sb4 OCI_ProcOutBind
 
     OCI_CHECK(NULL == bnd->stmt->rsts, OCI_ERROR)
 
-    rs = bnd->stmt->rsts[iter];
+    if (bnd->stmt->ret_rows)
+    {
+        OCI_CHECK((index >= bnd->stmt->ret_rows) || (iter >= bnd->stmt->nb_iters), OCI_ERROR)
+
+        rs  = bnd->stmt->rsts[0];
+        row = iter * bnd->stmt->ret_rows + index;
+    }
+    else
+    {
+        rs = bnd->stmt->rsts[iter];
+    }
 
     OCI_CHECK(NULL == rs, OCI_ERROR)
 
@@ -201,18 +259,18 @@ sb4 OCI_ProcOutBind
             case OCI_CDT_LOB:
             case OCI_CDT_FILE:
             {
-                *bufpp = def->buf.data[index];
+                *bufpp = def->buf.data[row];
                 break;
             }
             default:
             {
-                *bufpp = (((ub1*)def->buf.data) + (size_t) (def->col.bufsize * index));
+                *bufpp = (((ub1*)def->buf.data) + (size_t) (def->col.bufsize * row));
                 break;
             }
         }
 
-        *alenp  = (ub4   *) (((ub1 *) def->buf.lens) + (size_t) ((ub4) def->buf.sizelen * index));
-        *indp   = (dvoid *) (((ub1 *) def->buf.inds) + (size_t) ((ub4) sizeof(sb2)      * index));
+        *alenp  = (ub4   *) (((ub1 *) def->buf.lens) + (size_t) ((ub4) def->buf.sizelen * row));
+        *indp   = (dvoid *) (((ub1 *) def->buf.inds) + (size_t) ((ub4) sizeof(sb2)      * row));
         *piecep = (ub1    ) OCI_ONE_PIECE;
         *rcodep = (ub2   *) NULL;
     }
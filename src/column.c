@@ -505,6 +505,39 @@ boolean OCI_ColumnMap
             col->subtype  = OCI_NUM_NUMBER;
             col->libcode  = SQLT_VNU;
             col->bufsize  = sizeof(OCINumber);
+
+            /* in native numeric define mode, NUMBER columns with a known precision
+               are directly fetched as native integers or doubles */
+
+            if ((SQLT_NUM == col->sqlcode) && (stmt && OCI_NDM_NATIVE == stmt->num_mode) &&
+                (col->prec > 0) && (SCALE_FLOAT != col->scale))
+            {
+
+            #if OCI_VERSION_COMPILE >= OCI_11_2
+
+                if ((OCILib.version_runtime >= OCI_11_2) && (col->scale <= 0) &&
+                    ((col->prec - col->scale) <= OCI_NUM_NATIVE_INT_DIGITS))
+                {
+                    col->subtype  = OCI_NUM_BIGINT;
+                    col->libcode  = SQLT_INT;
+                    col->bufsize  = sizeof(big_int);
+                }
+
+            #endif
+
+            #if OCI_VERSION_COMPILE >= OCI_10_1
+
+                if ((OCILib.version_runtime >= OCI_10_1) && (SQLT_VNU == col->libcode) &&
+                    (col->prec <= OCI_NUM_NATIVE_DBL_DIGITS))
+                {
+                    col->subtype  = OCI_NUM_DOUBLE;
+                    col->libcode  = SQLT_BDOUBLE;
+                    col->bufsize  = sizeof(double);
+                }
+
+            #endif
+
+            }
             break;
         }
 
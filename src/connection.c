@@ -125,6 +125,8 @@ OCI_Connection * OCI_ConnectionAllocate
             con->pool     = pool;
             con->sess_tag = NULL;
 
+            con->scache.size = OCI_DEFAUT_STMT_CACHE_SIZE;
+
             if (con->pool)
             {
                 con->db   = (otext *) db;
@@ -737,6 +739,10 @@ boolean OCI_ConnectionLogOff
     OCI_CHECK(NULL == con, FALSE)
     OCI_CHECK(con->cstate != OCI_CONN_LOGGED, FALSE)
 
+    /* restore blocking mode on the server handle */
+
+    OCI_ConnectionSetNonBlocking(con, FALSE);
+
     /* close opened files */
 
     if (con->nb_files > 0)
@@ -750,6 +756,8 @@ boolean OCI_ConnectionLogOff
 
     /* free all statements */
 
+    con->scache.count = 0;
+
     OCI_ListForEach(con->stmts, (POCI_LIST_FOR_EACH) OCI_StatementClose);
     OCI_ListClear(con->stmts);
 
@@ -893,6 +901,8 @@ boolean OCI_ConnectionClose
     OCI_ListFree(con->trsns);
     OCI_ListFree(con->tinfs);
 
+    OCI_FREE(con->scache.entries)
+
     /* free strings */
 
     for (i = 0; i < OCI_FMT_COUNT; i++)
@@ -928,6 +938,121 @@ boolean OCI_ConnectionClose
     return TRUE;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementCacheHash
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_StatementCacheHash
+(
+    const otext *sql
+)
+{
+    unsigned int hash = 0;
+
+    while (*sql)
+    {
+        hash = (hash * 31) + (unsigned int) *sql++;
+    }
+
+    return hash;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementCacheRemove
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_StatementCacheRemove
+(
+    OCI_Connection *con,
+    OCI_Statement  *stmt
+)
+{
+    OCI_StatementCache *cache = &con->scache;
+
+    boolean res = FALSE;
+    unsigned int i;
+
+    for (i = 0; (i < cache->count) && !res; i++)
+    {
+        if (cache->entries[i].stmt == stmt)
+        {
+            /* entries are not ordered : move the last one in the free slot */
+
+            cache->entries[i] = cache->entries[--cache->count];
+
+            res = TRUE;
+        }
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_StatementCacheEvict
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_StatementCacheEvict
+(
+    OCI_Connection *con
+)
+{
+    OCI_StatementCache *cache = &con->scache;
+    OCI_Statement      *stmt  = NULL;
+
+    unsigned int i, lru = 0;
+
+    OCI_CHECK(0 == cache->count, FALSE)
+
+    /* find the least recently used statement */
+
+    for (i = 1; i < cache->count; i++)
+    {
+        if (cache->entries[i].stamp < cache->entries[lru].stamp)
+        {
+            lru = i;
+        }
+    }
+
+    stmt = cache->entries[lru].stmt;
+
+    OCI_StatementCacheRemove(con, stmt);
+
+    return OCI_StatementFree(stmt);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ConnectionSetNonBlocking
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ConnectionSetNonBlocking
+(
+    OCI_Connection *con,
+    boolean         value
+)
+{
+    boolean res = TRUE;
+
+    OCI_CHECK(NULL == con, FALSE)
+    OCI_CHECK(con->nb_mode == value, TRUE)
+
+    /* setting this server handle attribute toggles the mode, whatever the value */
+
+    OCI_CALL2
+    (
+        res, con,
+
+        OCIAttrSet((dvoid *) con->svr, (ub4) OCI_HTYPE_SERVER, (dvoid *) NULL,
+                   (ub4) 0, (ub4) OCI_ATTR_NONBLOCKING_MODE, con->err)
+    )
+
+    if (res)
+    {
+        con->nb_mode = value;
+    }
+
+    return res;
+}
+
 /* ********************************************************************************************* *
  *                             PUBLIC FUNCTIONS
  * ********************************************************************************************* */
@@ -976,7 +1101,6 @@ boolean OCI_API OCI_ConnectionFree
     call_retval = call_status = OCI_ConnectionClose(con);
 
     OCI_ListRemove(OCILib.cons, con);
-    OCI_FREE(con)
 
     OCI_LIB_CALL_EXIT()
 }
@@ -1075,6 +1199,46 @@ boolean OCI_API OCI_GetAutoCommit
     OCI_LIB_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetFormatBinding
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetFormatBinding
+(
+    OCI_Connection *con,
+    boolean         enable
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    con->fmt_bind = enable;
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetFormatBinding
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_GetFormatBinding
+(
+    OCI_Connection *con
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    call_retval = con->fmt_bind;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_IsConnected
  * --------------------------------------------------------------------------------------------- */
@@ -2374,6 +2538,216 @@ boolean OCI_API OCI_SetStatementCacheSize
     OCI_LIB_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetCachedStatement
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Statement * OCI_API OCI_GetCachedStatement
+(
+    OCI_Connection *con,
+    const otext    *sql
+)
+{
+    OCI_StatementCache      *cache = NULL;
+    OCI_StatementCacheEntry *entry = NULL;
+    OCI_Statement           *stmt  = NULL;
+
+    unsigned int hash = 0;
+    unsigned int i;
+
+    OCI_LIB_CALL_ENTER(OCI_Statement *, NULL)
+
+    OCI_CHECK_PTR(OCI_IPC_CONNECTION, con)
+    OCI_CHECK_PTR(OCI_IPC_STRING, sql)
+
+    cache = &con->scache;
+    hash  = OCI_StatementCacheHash(sql);
+
+    /* lookup */
+
+    for (i = 0; (i < cache->count) && !entry; i++)
+    {
+        OCI_Statement *cached = cache->entries[i].stmt;
+
+        if ((cache->entries[i].hash == hash) && cached->sql && (0 == ostrcmp(cached->sql, sql)))
+        {
+            entry = &cache->entries[i];
+        }
+    }
+
+    if (entry)
+    {
+        cache->hits++;
+
+        call_status = TRUE;
+    }
+    else
+    {
+        cache->misses++;
+
+        /* allocate the entries on first use */
+
+        if (!cache->entries)
+        {
+            cache->entries = (OCI_StatementCacheEntry *) OCI_MemAlloc(OCI_IPC_STMT_CACHE_ARRAY,
+                                                                      sizeof(*cache->entries),
+                                                                      (size_t) cache->size, TRUE);
+        }
+
+        /* create and prepare a new statement */
+
+        if (cache->entries)
+        {
+            stmt = OCI_StatementCreate(con);
+        }
+
+        if (stmt)
+        {
+            call_status = OCI_PrepareInternal(stmt, sql);
+        }
+
+        /* make room for it */
+
+        if (call_status && (cache->count >= cache->size))
+        {
+            call_status = OCI_StatementCacheEvict(con);
+        }
+
+        if (call_status)
+        {
+            entry = &cache->entries[cache->count++];
+
+            entry->stmt = stmt;
+            entry->hash = hash;
+        }
+        else if (stmt)
+        {
+            OCI_StatementFree(stmt);
+        }
+    }
+
+    if (entry)
+    {
+        entry->stamp = ++cache->stamp;
+
+        call_retval = entry->stmt;
+    }
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetStatementObjectCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetStatementObjectCacheSize
+(
+    OCI_Connection *con
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, 0)
+
+    OCI_CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    call_retval = con->scache.size;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetStatementObjectCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetStatementObjectCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    OCI_StatementCache *cache = NULL;
+
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_CONNECTION, con)
+    OCI_CHECK_MIN(con, NULL, value, 1)
+
+    cache = &con->scache;
+
+    call_status = TRUE;
+
+    /* drop the least recently used statements that do not fit anymore */
+
+    while (call_status && (cache->count > value))
+    {
+        call_status = OCI_StatementCacheEvict(con);
+    }
+
+    if (call_status && cache->entries)
+    {
+        cache->entries = (OCI_StatementCacheEntry *) OCI_MemRealloc(cache->entries,
+                                                                    OCI_IPC_STMT_CACHE_ARRAY,
+                                                                    sizeof(*cache->entries),
+                                                                    (size_t) value);
+
+        call_status = (NULL != cache->entries);
+
+        if (!call_status)
+        {
+            /* the cached statements are still owned by the connection statement list */
+
+            cache->count = 0;
+        }
+    }
+
+    if (call_status)
+    {
+        cache->size = value;
+    }
+
+    call_retval = call_status;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetStatementObjectCacheHits
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetStatementObjectCacheHits
+(
+    OCI_Connection *con
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, 0)
+
+    OCI_CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    call_retval = con->scache.hits;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetStatementObjectCacheMisses
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetStatementObjectCacheMisses
+(
+    OCI_Connection *con
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, 0)
+
+    OCI_CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    call_retval = con->scache.misses;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_GetDefaultLobPrefetchSize
  * --------------------------------------------------------------------------------------------- */
@@ -2551,9 +2925,16 @@ boolean OCI_ImmediateFmt
 
                 if (OCI_ParseSqlFmt(stmt, sql_fmt, sql, &args) > 0)
                 {
-                    /* prepare and execute SQL buffer */
+                    va_list bind_args;
+
+                    /* prepare, bind values if requested and execute SQL buffer */
+
+                    va_start(bind_args, sql);
+
+                    call_status = (OCI_PrepareInternal(stmt, sql_fmt) && OCI_BindSqlFmt(stmt, sql, &bind_args) &&
+                                   OCI_ExecuteInternal(stmt, OCI_DEFAULT));
 
-                    call_status = (OCI_PrepareInternal(stmt, sql_fmt) && OCI_ExecuteInternal(stmt, OCI_DEFAULT));
+                    va_end(bind_args);
 
                     /* get resultset and set up variables */
 
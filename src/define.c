@@ -149,11 +149,65 @@ void * OCI_DefineGetData
         {
             /* scalar types */
 
+            if (def->expanded)
+            {
+                OCI_DefineExpandString(def, def->rs->row_cur-1);
+            }
+
             return (((ub1 *) (def->buf.data)) + (size_t) (def->col.bufsize * (def->rs->row_cur-1)));
         }
     }
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_DefineExpandString
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_DefineExpandString
+(
+    OCI_Define *def,
+    ub4         index
+)
+{
+    ub1  mask = (ub1) (1 << (index % 8));
+    int  size = 0;
+    int  len  = 0;
+
+    OCI_CHECK(NULL == def, FALSE)
+    OCI_CHECK(NULL == def->expanded, FALSE)
+
+    if (!(def->expanded[index / 8] & mask))
+    {
+        size = (int) (def->col.bufsize / sizeof(otext)) - 1;
+        len  = size;
+
+        /* the length returned by Oracle is an upper bound of the number of characters
+           to expand, so that short strings do not pay for the whole buffer */
+
+        if (def->buf.sizelen == (int) sizeof(ub2))
+        {
+            len = (int) ((ub2 *) def->buf.lens)[index];
+        }
+        else if (def->buf.sizelen == (int) sizeof(ub4))
+        {
+            len = (int) ((ub4 *) def->buf.lens)[index];
+        }
+
+        if ((len < 0) || (len > size))
+        {
+            len = size;
+        }
+
+        OCI_StringUTF16ToUTF32(((ub1 *) def->buf.data) + (size_t) (def->col.bufsize * index),
+                               ((ub1 *) def->buf.data) + (size_t) (def->col.bufsize * index),
+                               len);
+
+        def->expanded[index / 8] |= mask;
+    }
+
+    return TRUE;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_DefineIsDataNotNull
  * --------------------------------------------------------------------------------------------- */
@@ -312,6 +366,16 @@ boolean OCI_DefineAlloc
         res = (NULL != def->buf.data);
     }
 
+    /* Allocate the bitmap of expanded strings for Unicode builds that need buffer expansion */
+
+    if (res && OCILib.use_wide_char_conv && (OCI_CDT_TEXT == def->col.datatype))
+    {
+        def->expanded = (ub1 *) OCI_MemAlloc(OCI_IPC_BUFF_ARRAY, (size_t) 1,
+                                             (size_t) ((def->buf.count + 7) / 8), TRUE);
+
+        res = (NULL != def->expanded);
+    }
+
     /* Allocate descriptor for cursor, lob and file, interval and timestamp */
 
     if (res && OCI_UNKNOWN != def->col.handletype)
@@ -413,6 +477,45 @@ boolean OCI_DefineDef
         )
     }
 
+#if OCI_VERSION_COMPILE >= OCI_11_1
+
+    /* LOB columns in inline mode : values up to the inline size are prefetched with
+       their locator and are read without extra round trips, bigger values are read
+       through the locator */
+
+    if (res && (OCI_CDT_LOB == def->col.datatype) && (OCI_LDM_INLINE == def->rs->stmt->lob_mode) &&
+        (OCILib.version_runtime >= OCI_11_1))
+    {
+        ub4     size   = def->rs->stmt->lob_size;
+        boolean length = TRUE;
+
+        OCI_CALL1
+        (
+            res, def->rs->stmt->con, def->rs->stmt,
+
+            OCIAttrSet((dvoid *) def->buf.handle,
+                       (ub4    ) OCI_HTYPE_DEFINE,
+                       (dvoid *) &size,
+                       (ub4    ) sizeof(size),
+                       (ub4    ) OCI_ATTR_LOBPREFETCH_SIZE,
+                       def->rs->stmt->con->err)
+        )
+
+        OCI_CALL1
+        (
+            res, def->rs->stmt->con, def->rs->stmt,
+
+            OCIAttrSet((dvoid *) def->buf.handle,
+                       (ub4    ) OCI_HTYPE_DEFINE,
+                       (dvoid *) &length,
+                       (ub4    ) sizeof(length),
+                       (ub4    ) OCI_ATTR_LOBPREFETCH_LENGTH,
+                       def->rs->stmt->con->err)
+        )
+    }
+
+#endif
+
     if(((OCI_CDT_TEXT == def->col.datatype))  ||
        ((OCI_CDT_LOB  == def->col.datatype)  && (OCI_BLOB  != def->col.subtype)) ||
        ((OCI_CDT_FILE == def->col.datatype)  && (OCI_BFILE != def->col.subtype)) ||
@@ -66,7 +66,9 @@ void OCI_ErrorFree
         return;
     }
 
-    OCI_FREE(err)
+    /* errors are allocated with calloc() as memory errors must be reported without allocations */
+
+    free(err);
 }
 
 /* --------------------------------------------------------------------------------------------- *
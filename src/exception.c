@@ -102,7 +102,14 @@ static otext * OCILib_TypeNames[OCI_IPC_COUNT] =
     OTEXT("Internal Long handle data buffer"),
     OTEXT("Internal trace info structure"),
     OTEXT("Internal array of direct path columns"),
-    OTEXT("Internal array of batch error objects")
+    OTEXT("Internal array of batch error objects"),
+    OTEXT("Internal array of statement handles"),
+    OTEXT("Internal array of structure field layouts"),
+    OTEXT("Internal array of fetch window entries"),
+    OTEXT("Internal array of partition workers"),
+    OTEXT("Internal array of statement cache entries"),
+    OTEXT("Internal array of placeholders"),
+    OTEXT("Internal arena chunk")
 };
 
 #if defined(OCI_CHARSET_WIDE) && !defined(_MSC_VER)
@@ -136,7 +143,8 @@ static otext * OCILib_ErrorMsg[OCI_ERR_COUNT] =
     OTEXT("Name or position '%ls' previously binded with different data type"),
     OTEXT("Object '%ls' type does not match the requested object type"),
     OTEXT("Item '%ls' (type %d)  not found"),
-    OTEXT("Argument '%ls' : Invalid value %d")
+    OTEXT("Argument '%ls' : Invalid value %d"),
+    OTEXT("A non blocking call is pending on the connection")
 };
 
 #else
@@ -170,7 +178,8 @@ static otext * OCILib_ErrorMsg[OCI_ERR_COUNT] =
     OTEXT("Name or position '%s' previously binded with different datatype"),
     OTEXT("Object '%s' type does not match the requested object type"),
     OTEXT("Item '%s' (type %d)  not found"),
-    OTEXT("Argument '%s' : Invalid value %d")
+    OTEXT("Argument '%s' : Invalid value %d"),
+    OTEXT("A non blocking call is pending on the connection")
 };
 
 #endif
@@ -215,7 +224,8 @@ static otext * OCILib_HandleNames[OCI_HDLE_COUNT] =
 {
     OTEXT("OCI handle"),
     OTEXT("OCI descriptors"),
-    OTEXT("OCI Object handles")
+    OTEXT("OCI Object handles"),
+    OTEXT("OCILIB memory blocks")
 };
 
 /* ********************************************************************************************* *
@@ -262,6 +272,48 @@ void OCI_ExceptionRaise
     }
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ExceptionGetTypeName
+ * --------------------------------------------------------------------------------------------- */
+
+const otext * OCI_ExceptionGetTypeName
+(
+    int type
+)
+{
+    OCI_CHECK((type < 1) || (type > OCI_IPC_COUNT), NULL)
+
+    return OCILib_TypeNames[type-1];
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ExceptionForward
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ExceptionForward
+(
+    OCI_Error *src
+)
+{
+    OCI_Error *err = OCI_ExceptionGetError();
+
+    if (err)
+    {
+        /* connection and statement of the source error may not exist anymore */
+
+        err->type    = src->type;
+        err->libcode = src->libcode;
+        err->sqlcode = src->sqlcode;
+        err->row     = src->row;
+
+        ostrncpy(err->str, src->str, osizeof(err->str) - (size_t) 1);
+
+        err->str[osizeof(err->str) - (size_t) 1] = 0;
+    }
+
+    OCI_ExceptionRaise(err);
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ExceptionOCI
  * --------------------------------------------------------------------------------------------- */
@@ -1066,3 +1118,28 @@ void OCI_ExceptionArgInvalidValue
     OCI_ExceptionRaise(err);
 }
 
+/* --------------------------------------------------------------------------------------------- *
+* OCI_ExceptionAsyncPending
+* --------------------------------------------------------------------------------------------- */
+
+void OCI_ExceptionAsyncPending
+(
+    OCI_Connection *con,
+    OCI_Statement  *stmt
+)
+{
+    OCI_Error *err = OCI_ExceptionGetError();
+
+    if (err)
+    {
+        err->type    = OCI_ERR_OCILIB;
+        err->libcode = OCI_ERR_ASYNC_PENDING;
+        err->stmt    = stmt;
+        err->con     = con;
+
+        ostrncat(err->str, OCILib_ErrorMsg[OCI_ERR_ASYNC_PENDING], osizeof(err->str) - (size_t) 1);
+    }
+
+    OCI_ExceptionRaise(err);
+}
+
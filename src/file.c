@@ -97,10 +97,9 @@ OCI_File * OCI_FileInit
 
             file->hstate = OCI_OBJECT_ALLOCATED;
 
-            res = OCI_SUCCESSFUL(OCI_DescriptorAlloc((dvoid *) file->con->env,
-                                                     (dvoid **) (void *) &file->handle,
-                                                     (ub4) OCI_DTYPE_LOB,
-                                                     (size_t) 0, (dvoid **) NULL));
+            res = OCI_SUCCESSFUL(OCI_DescriptorAllocCached((dvoid *) file->con->env,
+                                                           (dvoid **) (void *) &file->handle,
+                                                           (ub4) OCI_DTYPE_LOB));
         }
         else if (OCI_OBJECT_ALLOCATED_ARRAY != file->hstate)
         {
@@ -254,7 +253,7 @@ boolean OCI_API OCI_FileFree
 
     if (OCI_OBJECT_ALLOCATED == file->hstate)
     {
-        OCI_DescriptorFree((dvoid *) file->handle, (ub4) OCI_DTYPE_LOB);
+        OCI_DescriptorFreeCached((dvoid *) file->con->env, (dvoid *) file->handle, (ub4) OCI_DTYPE_LOB);
     }
 
     if (OCI_OBJECT_ALLOCATED_ARRAY != file->hstate)
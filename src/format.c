@@ -38,6 +38,276 @@
  *                             PRIVATE FUNCTIONS
  * ********************************************************************************************* */
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FormatStore
+ * --------------------------------------------------------------------------------------------- */
+
+void * OCI_FormatStore
+(
+    OCI_Statement *stmt,
+    const void    *value,
+    size_t         size
+)
+{
+    /* the statement arena owns the copies of the bound values until it is reset */
+
+    void *data = OCI_ArenaAlloc(&stmt->arena, size, (size_t) 1);
+
+    if (data)
+    {
+        memcpy(data, value, size);
+    }
+
+    return data;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FormatBind
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FormatBind
+(
+    OCI_Statement *stmt,
+    const otext  **pformat,
+    va_list       *pargs,
+    unsigned int   index,
+    boolean        bind
+)
+{
+    boolean      res  = TRUE;
+    void        *data = NULL;
+    const otext *str  = NULL;
+    otext        name[32];
+    otext        temp[128];
+
+    temp[0] = 0;
+
+    osprintf(name, (int) osizeof(name) - 1, OTEXT(":%u"), index);
+
+    /* dates and timestamps are bound natively, intervals are bound as strings.
+       NULL objects and empty strings are bound as NULL strings */
+
+    switch (**pformat)
+    {
+        case OTEXT('s'):
+        {
+            str = (const otext *) va_arg(*pargs, const otext *);
+
+            if (!str)
+            {
+                str = temp;
+            }
+
+            break;
+        }
+        case OTEXT('t'):
+        {
+            OCI_Date *date = (OCI_Date *) va_arg(*pargs, OCI_Date *);
+
+            if (date && bind)
+            {
+                res = OCI_BindDate(stmt, name, date);
+            }
+            else
+            {
+                str = temp;
+            }
+
+            break;
+        }
+        case OTEXT('p'):
+        {
+            OCI_Timestamp *tmsp = (OCI_Timestamp *) va_arg(*pargs, OCI_Timestamp *);
+
+            if (tmsp && bind)
+            {
+                res = OCI_BindTimestamp(stmt, name, tmsp);
+            }
+            else
+            {
+                str = temp;
+            }
+
+            break;
+        }
+        case OTEXT('v'):
+        {
+            OCI_Interval *itv = (OCI_Interval *) va_arg(*pargs, OCI_Interval *);
+
+            if (itv && bind)
+            {
+                OCI_IntervalToText(itv, 3, 3, (int) osizeof(temp)- 1, temp);
+            }
+
+            str = temp;
+            break;
+        }
+        case OTEXT('i'):
+        {
+            int value = va_arg(*pargs, int);
+
+            if (bind)
+            {
+                data = OCI_FormatStore(stmt, &value, sizeof(value));
+                res  = (NULL != data) && OCI_BindInt(stmt, name, (int *) data);
+            }
+
+            break;
+        }
+        case OTEXT('u'):
+        {
+            unsigned int value = va_arg(*pargs, unsigned int);
+
+            if (bind)
+            {
+                data = OCI_FormatStore(stmt, &value, sizeof(value));
+                res  = (NULL != data) && OCI_BindUnsignedInt(stmt, name, (unsigned int *) data);
+            }
+
+            break;
+        }
+        case OTEXT('l'):
+        {
+            (*pformat)++;
+
+            if (OTEXT('i') == **pformat)
+            {
+                big_int value = va_arg(*pargs, big_int);
+
+                if (bind)
+                {
+                    data = OCI_FormatStore(stmt, &value, sizeof(value));
+                    res  = (NULL != data) && OCI_BindBigInt(stmt, name, (big_int *) data);
+                }
+            }
+            else if (OTEXT('u') == **pformat)
+            {
+                big_uint value = va_arg(*pargs, big_uint);
+
+                if (bind)
+                {
+                    data = OCI_FormatStore(stmt, &value, sizeof(value));
+                    res  = (NULL != data) && OCI_BindUnsignedBigInt(stmt, name, (big_uint *) data);
+                }
+            }
+            else
+            {
+                OCI_ExceptionParsingToken(stmt->con, stmt, **pformat);
+
+                res = FALSE;
+            }
+
+            break;
+        }
+        case OTEXT('h'):
+        {
+            (*pformat)++;
+
+            /* short int must be passed as int to va_args */
+
+            if (OTEXT('i') == **pformat)
+            {
+                short value = (short) va_arg(*pargs, int);
+
+                if (bind)
+                {
+                    data = OCI_FormatStore(stmt, &value, sizeof(value));
+                    res  = (NULL != data) && OCI_BindShort(stmt, name, (short *) data);
+                }
+            }
+            else if (OTEXT('u') == **pformat)
+            {
+                unsigned short value = (unsigned short) va_arg(*pargs, unsigned int);
+
+                if (bind)
+                {
+                    data = OCI_FormatStore(stmt, &value, sizeof(value));
+                    res  = (NULL != data) && OCI_BindUnsignedShort(stmt, name, (unsigned short *) data);
+                }
+            }
+            else
+            {
+                OCI_ExceptionParsingToken(stmt->con, stmt, **pformat);
+
+                res = FALSE;
+            }
+
+            break;
+        }
+        case OTEXT('g'):
+        {
+            double value = va_arg(*pargs, double);
+
+            if (bind)
+            {
+                data = OCI_FormatStore(stmt, &value, sizeof(value));
+                res  = (NULL != data) && OCI_BindDouble(stmt, name, (double *) data);
+            }
+
+            break;
+        }
+        default:
+        {
+            OCI_ExceptionParsingToken(stmt->con, stmt, **pformat);
+
+            res = FALSE;
+        }
+    }
+
+    /* empty strings are bound as NULL values */
+
+    if (res && str && bind)
+    {
+        data = OCI_FormatStore(stmt, str, (ostrlen(str) + 1) * sizeof(otext));
+        res  = (NULL != data) && OCI_BindString(stmt, name, (otext *) data, 0);
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BindSqlFmt
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_BindSqlFmt
+(
+    OCI_Statement *stmt,
+    const otext   *format,
+    va_list       *pargs
+)
+{
+    boolean      res      = TRUE;
+    unsigned int nb_binds = 0;
+    const otext *pf       = format;
+
+    OCI_CHECK(!stmt->con->fmt_bind, TRUE)
+
+    for (; *pf && res; pf++)
+    {
+        if (OTEXT('%') == *pf)
+        {
+            pf++;
+
+            /* meta data strings and references are formatted in the SQL text */
+
+            if (OTEXT('m') == *pf)
+            {
+                va_arg(*pargs, const otext *);
+            }
+            else if (OTEXT('r') == *pf)
+            {
+                va_arg(*pargs, OCI_Ref *);
+            }
+            else if (OTEXT('%') != *pf)
+            {
+                res = OCI_FormatBind(stmt, &pf, pargs, ++nb_binds, TRUE);
+            }
+        }
+    }
+
+    return res;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ParseSqlFmt
  * --------------------------------------------------------------------------------------------- */
@@ -55,6 +325,7 @@ int OCI_ParseSqlFmt
     boolean quote   = FALSE;
     otext *pb       = buf;
     const otext *pf = format;
+    unsigned int nb_binds = 0;
 
     OCI_CHECK(NULL == format, 0);
 
@@ -87,6 +358,30 @@ int OCI_ParseSqlFmt
             }
         }
 
+        /* in binding mode, values are replaced by placeholders and bound by OCI_BindSqlFmt() */
+
+        if (quote && stmt->con->fmt_bind && (OTEXT('m') != *pf) && (OTEXT('r') != *pf))
+        {
+            otext temp[64];
+
+            if (!OCI_FormatBind(stmt, &pf, pargs, ++nb_binds, FALSE))
+            {
+                return 0;
+            }
+
+            len = (int) osprintf(temp, (int) osizeof(temp) - 1, OTEXT(":%u"), nb_binds);
+
+            if (buf)
+            {
+                ostrcpy(pb, temp);
+
+                pb += (size_t) len;
+            }
+
+            size += len;
+            continue;
+        }
+
         switch (*pf)
         {
             case OTEXT('s'):
@@ -40,6 +40,11 @@
 
 static unsigned int HashTypeValues[] = { OCI_HASH_STRING, OCI_HASH_INTEGER, OCI_HASH_POINTER };
 
+/* ASCII characters are folded inline, others go through the C runtime */
+
+#define OCI_HASH_FOLD(c)                                                       \
+    (((c) >= OTEXT('a') && (c) <= OTEXT('z')) ? (unsigned int) ((c) - OTEXT('a') + OTEXT('A')) : \
+     (((unsigned int) (c)) < 0x80) ? (unsigned int) (c) : (unsigned int) otoupper(c))
 
 /* ********************************************************************************************* *
  *                             PRIVATE FUNCTIONS
@@ -51,25 +56,93 @@ static unsigned int HashTypeValues[] = { OCI_HASH_STRING, OCI_HASH_INTEGER, OCI_
 
 unsigned int OCI_HashCompute
 (
-    OCI_HashTable *table,
-    const otext   *str
+    const otext *str
 )
 {
-    unsigned int h;
-    otext *p;
-    otext c;
+    unsigned int h = 0;
 
-    OCI_CHECK(NULL == table, 0);
     OCI_CHECK(NULL == str, 0);
 
-    for(h = 0, p = (otext *) str; (*p) != 0; p++)
+    for (; (*str) != 0; str++)
+    {
+        h = 31 * h + OCI_HASH_FOLD(*str);
+    }
+
+    /* spread the high bits as slots are indexed with the low bits */
+
+    return h ^ (h >> 16);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HashFindSlot
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_HashSlot * OCI_HashFindSlot
+(
+    OCI_HashSlot *items,
+    unsigned int  size,
+    const otext  *key,
+    unsigned int  hash
+)
+{
+    unsigned int mask = size - 1;
+    unsigned int i    = hash & mask;
+
+    /* linear probing : the table is never full, so an empty slot ends the search */
+
+    while (items[i].entry)
     {
-        c = *p;
+        if (items[i].hash == hash && ostrcasecmp(items[i].entry->key, key) == 0)
+        {
+            break;
+        }
 
-        h = 31 * h + otoupper(c);
+        i = (i + 1) & mask;
     }
 
-    return (h % table->size);
+    return &items[i];
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HashGrow
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_HashGrow
+(
+    OCI_HashTable *table
+)
+{
+    OCI_HashSlot *items = NULL;
+    unsigned int  size  = table->size * 2;
+    unsigned int  i, j;
+
+    items = (OCI_HashSlot *) OCI_MemAlloc(OCI_IPC_HASHENTRY_ARRAY, sizeof(*items), (size_t) size, TRUE);
+
+    OCI_CHECK(NULL == items, FALSE)
+
+    /* keys are unique, so entries are moved to the first empty slot of their probe sequence */
+
+    for (i = 0; i < table->size; i++)
+    {
+        if (table->items[i].entry)
+        {
+            j = table->items[i].hash & (size - 1);
+
+            while (items[j].entry)
+            {
+                j = (j + 1) & (size - 1);
+            }
+
+            items[j] = table->items[i];
+        }
+    }
+
+    OCI_FREE(table->items)
+
+    table->items = items;
+    table->size  = size;
+
+    return TRUE;
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -85,8 +158,8 @@ boolean OCI_HashAdd
 )
 {
     OCI_HashEntry * e = NULL;
-    OCI_HashValue * v = NULL, *v1 = NULL, *v2 = NULL;
-    boolean res = FALSE;
+    OCI_HashValue * v = NULL;
+    OCI_HashNode  * n = NULL;
 
     OCI_CHECK(NULL == table, FALSE)
     OCI_CHECK(NULL == key, FALSE)
@@ -94,47 +167,48 @@ boolean OCI_HashAdd
 
     e = OCI_HashLookup(table, key, TRUE);
 
-    if (e)
-    {
-        v = (OCI_HashValue *)OCI_MemAlloc(OCI_IPC_HASHVALUE, sizeof(*v), (size_t)1, TRUE);
+    OCI_CHECK(NULL == e, FALSE)
 
-        if (v)
-        {
-            if (OCI_HASH_STRING == table->type && value.p_text)
-            {
-                v->value.p_text = ostrdup(value.p_text);
-            }
-            else if (OCI_HASH_INTEGER == table->type)
-            {
-                v->value.num = value.num;
-            }
-            else
-            {
-                v->value.p_void = value.p_void;
-            }
+    n = (OCI_HashNode *) e;
 
-            v1 = v2 = e->values;
+    /* the first value is stored in the entry node */
 
-            while (v1)
-            {
-                v2 = v1;
-                v1 = v1->next;
-            }
+    if (!e->values)
+    {
+        v = &n->value;
+    }
+    else
+    {
+        v = (OCI_HashValue *)OCI_MemAlloc(OCI_IPC_HASHVALUE, sizeof(*v), (size_t)1, TRUE);
+    }
 
-            if (v2)
-            {
-                v2->next = v;
-            }
-            else
-            {
-                e->values = v;
-            }
+    OCI_CHECK(NULL == v, FALSE)
 
-            res = TRUE;
-        }
+    if (OCI_HASH_STRING == table->type && value.p_text)
+    {
+        v->value.p_text = ostrdup(value.p_text);
+    }
+    else if (OCI_HASH_INTEGER == table->type)
+    {
+        v->value.num = value.num;
+    }
+    else
+    {
+        v->value.p_void = value.p_void;
     }
 
-    return res;
+    if (n->last)
+    {
+        n->last->next = v;
+    }
+    else
+    {
+        e->values = v;
+    }
+
+    n->last = v;
+
+    return TRUE;
 }
 
 /* ********************************************************************************************* *
@@ -152,6 +226,7 @@ OCI_HashTable * OCI_API OCI_HashCreate
 )
 {
     OCI_HashTable *table = NULL;
+    unsigned int   slots = OCI_HASH_MIN_SIZE;
 
     OCI_LIB_CALL_ENTER(OCI_HashTable*, table)
 
@@ -161,7 +236,7 @@ OCI_HashTable * OCI_API OCI_HashCreate
 
     table = (OCI_HashTable *) OCI_MemAlloc(OCI_IPC_HASHTABLE, sizeof(*table), (size_t) 1, TRUE);
 
-    /* set up attributes and allocate internal array of hash entry pointers */
+    /* set up attributes and allocate internal array of slots */
 
     if (table)
     {
@@ -169,13 +244,20 @@ OCI_HashTable * OCI_API OCI_HashCreate
         table->size  = 0;
         table->count = 0;
 
-        table->items = (OCI_HashEntry **) OCI_MemAlloc(OCI_IPC_HASHENTRY_ARRAY,
-                                                       sizeof(*table->items),
-                                                       (size_t) size, TRUE);
+        /* slots are indexed with a mask, so their number is a power of 2 */
+
+        while (slots < size)
+        {
+            slots *= 2;
+        }
+
+        table->items = (OCI_HashSlot *) OCI_MemAlloc(OCI_IPC_HASHENTRY_ARRAY,
+                                                     sizeof(*table->items),
+                                                     (size_t) slots, TRUE);
         if (table->items)
         {
-            table->size = size;           
-            
+            table->size = slots;
+
             call_status = TRUE;
         }
     }
@@ -203,7 +285,7 @@ boolean OCI_API OCI_HashFree
 {
     unsigned int i;
 
-    OCI_HashEntry *e1 = NULL, *e2 = NULL;
+    OCI_HashNode  *n  = NULL;
     OCI_HashValue *v1 = NULL, *v2 = NULL;
 
     OCI_LIB_CALL_ENTER(boolean, FALSE)
@@ -214,38 +296,32 @@ boolean OCI_API OCI_HashFree
     {
         for (i = 0; i < table->size; i++)
         {
-            e1 = table->items[i];
+            n = (OCI_HashNode *) table->items[i].entry;
 
-            while (e1)
+            if (!n)
             {
-                e2 = e1;
-                e1 = e1->next;
-
-                v1 = e2->values;
-
-                while (v1)
-                {
-                    v2 = v1;
-                    v1 = v1->next;
+                continue;
+            }
 
-                    if (OCI_HASH_STRING == table->type)
-                    {
-                        OCI_FREE(v2->value.p_text)
-                    }
+            v1 = n->entry.values;
 
-                    OCI_FREE(v2)
-                }
+            while (v1)
+            {
+                v2 = v1;
+                v1 = v1->next;
 
-                if (e2->key)
+                if (OCI_HASH_STRING == table->type)
                 {
-                    OCI_FREE(e2->key)
+                    OCI_FREE(v2->value.p_text)
                 }
 
-                if (e2)
+                if (v2 != &n->value)
                 {
-                    OCI_FREE(e2)
+                    OCI_FREE(v2)
                 }
             }
+
+            OCI_FREE(n)
         }
 
         OCI_FREE(table->items)
@@ -339,7 +415,7 @@ OCI_HashEntry * OCI_API OCI_HashGetEntry
     
     if (index < table->size)
     {
-        call_retval = table->items[index];
+        call_retval = table->items[index].entry;
     }
 
     call_status = TRUE;
@@ -520,56 +596,63 @@ OCI_HashEntry * OCI_API OCI_HashLookup
     boolean        create
 )
 {
-    OCI_HashEntry *e = NULL, *e1 = NULL, *e2 = NULL;
-    unsigned int i;
+    OCI_HashSlot *slot = NULL;
+    OCI_HashNode *n    = NULL;
+    unsigned int  hash = 0;
+    size_t        len  = 0;
 
     OCI_LIB_CALL_ENTER(OCI_HashEntry*, NULL)
 
     OCI_CHECK_PTR(OCI_IPC_HASHTABLE, table)
     OCI_CHECK_PTR(OCI_IPC_STRING, key)
 
-    i = OCI_HashCompute(table, key);
+    call_status = TRUE;
+
+    hash = OCI_HashCompute(key);
+    slot = OCI_HashFindSlot(table->items, table->size, key, hash);
 
-    if (i < table->size)
+    if (!slot->entry && create)
     {
-        for(e = table->items[i]; e; e = e->next)
+        /* keep at least a quarter of the slots empty to bound probe sequences */
+
+        if ((table->count + 1) * 4 > table->size * 3)
         {
-            if (ostrcasecmp(e->key, key) == 0)
+            call_status = OCI_HashGrow(table);
+
+            if (call_status)
             {
-                break;
+                slot = OCI_HashFindSlot(table->items, table->size, key, hash);
             }
         }
 
-        if (!e && create)
+        if (call_status)
         {
-            e = (OCI_HashEntry *) OCI_MemAlloc(OCI_IPC_HASHENTRY, sizeof(*e), (size_t) 1, TRUE);
+            /* the key is stored in the same block than the entry */
 
-            if (e)
-            {
-                e->key = ostrdup(key);
+            len = ostrlen(key);
 
-                e1 = e2 = table->items[i];
+            n = (OCI_HashNode *) OCI_MemAlloc(OCI_IPC_HASHENTRY, sizeof(*n) + len * sizeof(otext), (size_t) 1, TRUE);
 
-                while (e1)
-                {
-                    e2 = e1;
-                    e1 = e1->next;
-                }
+            call_status = (NULL != n);
+        }
 
-                if (e2)
-                {
-                    e2->next = e;
-                }
-                else
-                {
-                    table->items[i] = e;
-                }
-            }
+        if (call_status)
+        {
+            ostrncat(n->key, key, len);
+
+            n->entry.key = n->key;
+
+            slot->hash  = hash;
+            slot->entry = &n->entry;
+
+            table->count++;
         }
     }
 
-    call_retval = e;
-    call_status = TRUE;
+    if (call_status)
+    {
+        call_retval = slot->entry;
+    }
 
     OCI_LIB_CALL_EXIT()
 }
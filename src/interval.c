@@ -100,10 +100,9 @@ OCI_Interval * OCI_IntervalInit
         {
             if (OCI_OBJECT_ALLOCATED_ARRAY != itv->hstate)
             {
-                res = OCI_SUCCESSFUL(OCI_DescriptorAlloc((dvoid  *) itv->env,
-                                                         (dvoid **) (void *) &itv->handle,
-                                                         (ub4) OCI_ExternalSubTypeToHandleType(OCI_CDT_INTERVAL, itv->type),
-                                                         (size_t)0, (dvoid **) NULL));
+                res = OCI_SUCCESSFUL(OCI_DescriptorAllocCached((dvoid  *) itv->env,
+                                                               (dvoid **) (void *) &itv->handle,
+                                                               (ub4) OCI_ExternalSubTypeToHandleType(OCI_CDT_INTERVAL, itv->type)));
 
                 itv->hstate = OCI_OBJECT_ALLOCATED;
             }
@@ -177,7 +176,7 @@ boolean OCI_API OCI_IntervalFree
 
     if (OCI_OBJECT_ALLOCATED == itv->hstate)
     {
-        OCI_DescriptorFree((dvoid *)itv->handle, OCI_ExternalSubTypeToHandleType(OCI_CDT_INTERVAL, itv->type));
+        OCI_DescriptorFreeCached((dvoid *)itv->env, (dvoid *)itv->handle, OCI_ExternalSubTypeToHandleType(OCI_CDT_INTERVAL, itv->type));
     }
 
     if (OCI_OBJECT_ALLOCATED_ARRAY != itv->hstate)
@@ -251,6 +251,7 @@ OCILOBLOADFROMFILE           OCILobLoadFromFile           = NULL;
 OCILOBWRITEAPPEND            OCILobWriteAppend            = NULL;
 OCISERVERVERSION             OCIServerVersion             = NULL;
 OCIBREAK                     OCIBreak                     = NULL;
+OCIRESET                     OCIReset                     = NULL;
 OCIATTRGET                   OCIAttrGet                   = NULL;
 OCIATTRSET                   OCIAttrSet                   = NULL;
 OCIDATEASSIGN                OCIDateAssign                = NULL;
@@ -722,6 +723,8 @@ boolean OCI_API OCI_Initialize
 
     memset(&OCILib, 0, sizeof(OCI_Library));
 
+    OCI_MemStatsInit(OCI_ENV_MEMORY_STATS == (mode & OCI_ENV_MEMORY_STATS));
+
     OCILib.error_handler        = err_handler;
 
     OCILib.version_compile      = OCI_VERSION_COMPILE;
@@ -868,6 +871,8 @@ boolean OCI_API OCI_Initialize
                    OCISERVERVERSION);
         LIB_SYMBOL(OCILib.lib_handle, "OCIBreak", OCIBreak,
                    OCIBREAK);
+        LIB_SYMBOL(OCILib.lib_handle, "OCIReset", OCIReset,
+                   OCIRESET);
 
         LIB_SYMBOL(OCILib.lib_handle, "OCIBindByPos", OCIBindByPos,
                    OCIBINDBYPOS);
@@ -1475,6 +1480,29 @@ boolean OCI_API OCI_Initialize
 
             res = (NULL != OCILib.arrs);
         }
+
+        /* setup OCI handles recycling pools */
+
+        if (res)
+        {
+            OCILib.hdl_cache_size = OCI_DEFAULT_HDL_CACHE_SIZE;
+
+            if (OCI_LIB_THREADED)
+            {
+                OCILib.hdl_cache_mutex = OCI_MutexCreateInternal();
+
+                res = (NULL != OCILib.hdl_cache_mutex);
+            }
+        }
+
+        /* memory statistics are updated from any thread */
+
+        if (res && OCI_LIB_THREADED && (OCILib.env_mode & OCI_ENV_MEMORY_STATS))
+        {
+            OCILib.mem_mutex = OCI_MutexCreateInternal();
+
+            res = (NULL != OCILib.mem_mutex);
+        }
     }
 
     if (res )
@@ -1548,6 +1576,28 @@ boolean OCI_API OCI_Cleanup
         OCI_FREE(OCILib.formats[i])
     }
 
+    /* release idle OCI handles */
+
+    OCI_HandleCacheResize(0);
+
+    if (OCILib.hdl_cache_mutex)
+    {
+        OCI_MutexFree(OCILib.hdl_cache_mutex);
+
+        OCILib.hdl_cache_mutex = NULL;
+    }
+
+    if (OCILib.mem_mutex)
+    {
+        OCI_Mutex *mutex = OCILib.mem_mutex;
+
+        /* the mutex structure itself is accounted */
+
+        OCILib.mem_mutex = NULL;
+
+        OCI_MutexFree(mutex);
+    }
+
     /* finalize OCIThread object support */
 
     if (OCI_LIB_THREADED)
@@ -1621,6 +1671,14 @@ boolean OCI_API OCI_Cleanup
         res = FALSE;
     }
 
+    /* checks for non freed memory blocks */
+
+    if (OCI_MemStatsGetBlocks() > 0)
+    {
+        OCI_ExceptionUnfreedData(OCI_HDLE_MEMORY, OCI_MemStatsGetBlocks());
+        res = FALSE;
+    }
+
     memset(&OCILib, 0, sizeof(OCILib));
 
     return res;
@@ -110,20 +110,14 @@ OCI_Item * OCI_ListCreateItem
 {
     OCI_Item *item = NULL;
 
-    /* allocate list item entry */
+    /* allocate list item entry and its data buffer in a single block, the
+       item being located right before the data it holds */
 
-    item = (OCI_Item *) OCI_MemAlloc(OCI_IPC_LIST_ITEM, sizeof(*item), (size_t) 1, TRUE);
+    item = (OCI_Item *) OCI_MemAlloc(type, OCI_LIST_ITEM_SIZE + (size_t) size, (size_t) 1, TRUE);
 
     if (item)
     {
-        /* allocate item data buffer */
-
-        item->data = (void *) OCI_MemAlloc(type, (size_t) size, (size_t) 1, TRUE);
-
-        if (!item->data)
-        {
-            OCI_FREE(item)
-        }
+        item->data = ((ub1 *) item) + OCI_LIST_ITEM_SIZE;
     }
 
     return item;
@@ -140,7 +134,6 @@ OCI_Item * OCI_ListAppend
 )
 {
     OCI_Item *item = NULL;
-    OCI_Item *temp = NULL;
 
     OCI_CHECK(NULL == list,  NULL);
 
@@ -153,22 +146,19 @@ OCI_Item * OCI_ListAppend
         OCI_MutexAcquire(list->mutex);
     }
 
-    temp = list->head;
+    item->prev = list->tail;
 
-    while (temp && temp->next)
+    if (list->tail)
     {
-        temp = temp->next;
-    }
-
-    if (temp)
-    {
-        temp->next = item;
+        list->tail->next = item;
     }
     else
     {
         list->head = item;
     }
 
+    list->tail = item;
+
     list->count++;
 
     if (list->mutex)
@@ -207,13 +197,13 @@ boolean OCI_ListClear
         temp = item;
         item = item->next;
 
-        /* free data */
+        /* free item and data */
 
-        OCI_FREE(temp->data)
         OCI_FREE(temp)
     }
 
     list->head  = NULL;
+    list->tail  = NULL;
     list->count = 0;
 
     if (list->mutex)
@@ -272,42 +262,35 @@ boolean OCI_ListRemove
 )
 {
     OCI_Item *item = NULL;
-    OCI_Item *temp = NULL;
 
     OCI_CHECK(NULL == list,  FALSE)
     OCI_CHECK(NULL == data, FALSE)
 
+    /* data was allocated by OCI_ListAppend() right after its item */
+
+    item = (OCI_Item *) (((ub1 *) data) - OCI_LIST_ITEM_SIZE);
+
     if (list->mutex)
     {
         OCI_MutexAcquire(list->mutex);
     }
 
-    item = list->head;
-
-    while (item)
+    if (item->prev)
     {
-        if (item->data == data)
-        {
-            if (temp)
-            {
-                temp->next = item->next;
-            }
-
-            /* if item was the first entry, readjust the first list
-               entry to next element */
-
-            if (item == list->head)
-            {
-                list->head = item->next;
-            }
-
-            OCI_FREE(item)
-
-            break;
-        }
+        item->prev->next = item->next;
+    }
+    else
+    {
+        list->head = item->next;
+    }
 
-        temp = item;
-        item = item->next;
+    if (item->next)
+    {
+        item->next->prev = item->prev;
+    }
+    else
+    {
+        list->tail = item->prev;
     }
 
     list->count--;
@@ -317,5 +300,9 @@ boolean OCI_ListRemove
         OCI_MutexRelease(list->mutex);
     }
 
+    /* free item and data */
+
+    OCI_FREE(item)
+
     return TRUE;
 }
@@ -107,10 +107,9 @@ OCI_Lob * OCI_LobInit
             {
                 lob->hstate = OCI_OBJECT_ALLOCATED;
 
-                res = OCI_SUCCESSFUL(OCI_DescriptorAlloc((dvoid  *) lob->con->env,
-                                                         (dvoid **) (void *) &lob->handle,
-                                                         (ub4) OCI_DTYPE_LOB,
-                                                         (size_t) 0, (dvoid **) NULL));
+                res = OCI_SUCCESSFUL(OCI_DescriptorAllocCached((dvoid  *) lob->con->env,
+                                                               (dvoid **) (void *) &lob->handle,
+                                                               (ub4) OCI_DTYPE_LOB));
             }
 
             OCI_CALL2
@@ -202,7 +201,7 @@ boolean OCI_API OCI_LobFree
 
     if (OCI_OBJECT_ALLOCATED == lob->hstate)
     {
-        OCI_DescriptorFree((dvoid *) lob->handle, (ub4) OCI_DTYPE_LOB);
+        OCI_DescriptorFreeCached((dvoid *) lob->con->env, (dvoid *) lob->handle, (ub4) OCI_DTYPE_LOB);
     }
 
     if (OCI_OBJECT_ALLOCATED_ARRAY != lob->hstate)
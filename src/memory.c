@@ -34,6 +34,28 @@
 
 #include "ocilib_internal.h"
 
+/* ********************************************************************************************* *
+ *                             PRIVATE VARIABLES
+ * ********************************************************************************************* */
+
+static POCI_MEM_ALLOC   MemAllocHandler   = malloc;
+static POCI_MEM_REALLOC MemReallocHandler = realloc;
+static POCI_MEM_FREE    MemFreeHandler    = free;
+
+static boolean      MemStatsEnabled = FALSE;
+static OCI_MemStats MemStats[OCI_IPC_COUNT + 1];
+
+static const ub4 HandleCacheTypes[OCI_HDL_CACHE_COUNT] =
+{
+    OCI_HTYPE_ERROR,
+    OCI_DTYPE_LOB,
+    OCI_DTYPE_TIMESTAMP,
+    OCI_DTYPE_TIMESTAMP_TZ,
+    OCI_DTYPE_TIMESTAMP_LTZ,
+    OCI_DTYPE_INTERVAL_YM,
+    OCI_DTYPE_INTERVAL_DS
+};
+
 /* ********************************************************************************************* *
  *                             PRIVATE FUNCTIONS
  * ********************************************************************************************* */
@@ -53,7 +75,24 @@ void * OCI_MemAlloc
     void * ptr  = NULL;
     size_t size = (size_t) (block_size * block_count);
 
-    ptr = (void *) malloc(size);
+    if (MemStatsEnabled)
+    {
+        OCI_MemHeader *hdr = (OCI_MemHeader *) MemAllocHandler(OCI_MEM_HEADER_SIZE + size);
+
+        if (hdr)
+        {
+            hdr->size = size;
+            hdr->type = ptr_type;
+
+            OCI_MemStatsUpdate(ptr_type, (size_t) 0, size, 1);
+
+            ptr = ((ub1 *) hdr) + OCI_MEM_HEADER_SIZE;
+        }
+    }
+    else
+    {
+        ptr = (void *) MemAllocHandler(size);
+    }
 
     if (ptr)
     {
@@ -83,7 +122,37 @@ void * OCI_MemRealloc
 )
 {
     size_t size = (size_t) (block_size * block_count);
-    void * ptr  = (void *) realloc(ptr_mem, size);
+    void * ptr  = NULL;
+
+    if (MemStatsEnabled)
+    {
+        OCI_MemHeader *hdr      = NULL;
+        size_t         size_old = 0;
+        int            type     = ptr_type;
+
+        if (ptr_mem)
+        {
+            hdr      = (OCI_MemHeader *) (((ub1 *) ptr_mem) - OCI_MEM_HEADER_SIZE);
+            size_old = hdr->size;
+            type     = hdr->type;
+        }
+
+        hdr = (OCI_MemHeader *) MemReallocHandler(hdr, OCI_MEM_HEADER_SIZE + size);
+
+        if (hdr)
+        {
+            hdr->size = size;
+            hdr->type = type;
+
+            OCI_MemStatsUpdate(type, size_old, size, ptr_mem ? 0 : 1);
+
+            ptr = ((ub1 *) hdr) + OCI_MEM_HEADER_SIZE;
+        }
+    }
+    else
+    {
+        ptr = (void *) MemReallocHandler(ptr_mem, size);
+    }
 
     if (!ptr && ptr_mem)
     {
@@ -106,7 +175,214 @@ void OCI_MemFree
 {
     if (ptr_mem)
     {
-        free(ptr_mem);
+        if (MemStatsEnabled)
+        {
+            OCI_MemHeader *hdr = (OCI_MemHeader *) (((ub1 *) ptr_mem) - OCI_MEM_HEADER_SIZE);
+
+            OCI_MemStatsUpdate(hdr->type, hdr->size, (size_t) 0, -1);
+
+            ptr_mem = hdr;
+        }
+
+        MemFreeHandler(ptr_mem);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemStatsInit
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_MemStatsInit
+(
+    boolean enabled
+)
+{
+    memset(MemStats, 0, sizeof(MemStats));
+
+    MemStatsEnabled = enabled;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemStatsUpdate
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_MemStatsUpdate
+(
+    int    ptr_type,
+    size_t size_old,
+    size_t size_new,
+    int    nb_blocks
+)
+{
+    int i;
+
+    if ((ptr_type < 1) || (ptr_type > OCI_IPC_COUNT))
+    {
+        ptr_type = OCI_IPC_VOID;
+    }
+
+    if (OCILib.mem_mutex)
+    {
+        OCI_MutexAcquire(OCILib.mem_mutex);
+    }
+
+    /* update the given type and the global statistics stored at index 0 */
+
+    for (i = 0; i < 2; i++)
+    {
+        OCI_MemStats *stats = &MemStats[i ? ptr_type : 0];
+
+        stats->cur_bytes += (big_uint) size_new;
+        stats->cur_bytes -= (big_uint) size_old;
+
+        if (nb_blocks > 0)
+        {
+            stats->cur_blocks++;
+            stats->nb_allocs++;
+        }
+        else if (nb_blocks < 0)
+        {
+            stats->cur_blocks--;
+        }
+
+        if (stats->cur_bytes > stats->max_bytes)
+        {
+            stats->max_bytes = stats->cur_bytes;
+        }
+    }
+
+    if (OCILib.mem_mutex)
+    {
+        OCI_MutexRelease(OCILib.mem_mutex);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_MemStatsGetBlocks
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_MemStatsGetBlocks
+(
+    void
+)
+{
+    return MemStatsEnabled ? MemStats[0].cur_blocks : 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArenaAlloc
+ * --------------------------------------------------------------------------------------------- */
+
+void * OCI_ArenaAlloc
+(
+    OCI_Arena *arena,
+    size_t     block_size,
+    size_t     block_count
+)
+{
+    OCI_ArenaChunk *chunk = arena->head;
+
+    size_t header = OCI_ARENA_ALIGN(sizeof(OCI_ArenaChunk));
+    size_t size   = OCI_ARENA_ALIGN(block_size * block_count);
+    void  *ptr    = NULL;
+
+    /* start a new chunk when the current one is full. Chunks hold objects of
+       different types, so they are accounted under their own memory type */
+
+    if (!chunk || ((chunk->size - chunk->used) < size))
+    {
+        size_t chunk_size = (size > OCI_ARENA_CHUNK_SIZE) ? size : OCI_ARENA_CHUNK_SIZE;
+
+        chunk = (OCI_ArenaChunk *) OCI_MemAlloc(OCI_IPC_ARENA_CHUNK, header + chunk_size, (size_t) 1, FALSE);
+
+        OCI_CHECK(NULL == chunk, NULL)
+
+        chunk->next = arena->head;
+        chunk->size = chunk_size;
+        chunk->used = 0;
+
+        arena->head = chunk;
+    }
+
+    ptr = ((ub1 *) chunk) + header + chunk->used;
+
+    chunk->used += size;
+
+    memset(ptr, 0, size);
+
+    return ptr;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArenaStrdup
+ * --------------------------------------------------------------------------------------------- */
+
+otext * OCI_ArenaStrdup
+(
+    OCI_Arena   *arena,
+    const otext *str
+)
+{
+    otext *dst = NULL;
+
+    OCI_CHECK(NULL == str, NULL)
+
+    dst = (otext *) OCI_ArenaAlloc(arena, sizeof(otext), ostrlen(str) + 1);
+
+    if (dst)
+    {
+        ostrcpy(dst, str);
+    }
+
+    return dst;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArenaReset
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArenaReset
+(
+    OCI_Arena *arena
+)
+{
+    OCI_ArenaChunk *chunk = arena->head;
+
+    if (chunk)
+    {
+        /* only the oldest chunk is kept for the next objects */
+
+        while (chunk->next)
+        {
+            OCI_ArenaChunk *next = chunk->next;
+
+            OCI_MemFree(chunk);
+
+            chunk = next;
+        }
+
+        chunk->used = 0;
+
+        arena->head = chunk;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ArenaFree
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_ArenaFree
+(
+    OCI_Arena *arena
+)
+{
+    while (arena->head)
+    {
+        OCI_ArenaChunk *next = arena->head->next;
+
+        OCI_MemFree(arena->head);
+
+        arena->head = next;
     }
 }
 
@@ -286,6 +562,232 @@ sword OCI_DescriptorArrayFree
     return ret;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HandleCacheGet
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_HandleCache * OCI_HandleCacheGet
+(
+    CONST dvoid *parenth,
+    CONST ub4    type
+)
+{
+    ub4 i;
+
+    /* handles from other environments (XA) are never recycled */
+
+    OCI_CHECK(OCILib.env != parenth, NULL)
+
+    for (i = 0; i < OCI_HDL_CACHE_COUNT; i++)
+    {
+        if (HandleCacheTypes[i] == type)
+        {
+            return &OCILib.hdl_caches[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HandleCachePop
+ * --------------------------------------------------------------------------------------------- */
+
+void * OCI_HandleCachePop
+(
+    OCI_HandleCache *cache
+)
+{
+    void *hndl = NULL;
+
+    OCI_CHECK(NULL == cache, NULL)
+
+    if (OCILib.hdl_cache_mutex)
+    {
+        OCI_MutexAcquire(OCILib.hdl_cache_mutex);
+    }
+
+    if (cache->count > 0)
+    {
+        hndl = cache->items[--cache->count];
+    }
+
+    if (OCILib.hdl_cache_mutex)
+    {
+        OCI_MutexRelease(OCILib.hdl_cache_mutex);
+    }
+
+    return hndl;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HandleCachePush
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_HandleCachePush
+(
+    OCI_HandleCache *cache,
+    void            *hndl
+)
+{
+    boolean res = FALSE;
+
+    OCI_CHECK(NULL == cache, FALSE)
+
+    if (OCILib.hdl_cache_mutex)
+    {
+        OCI_MutexAcquire(OCILib.hdl_cache_mutex);
+    }
+
+    if (cache->count < OCILib.hdl_cache_size)
+    {
+        if (!cache->items)
+        {
+            cache->items = (void **) OCI_MemAlloc(OCI_IPC_VOID, sizeof(*cache->items),
+                                                  (size_t) OCILib.hdl_cache_size, FALSE);
+        }
+
+        if (cache->items)
+        {
+            cache->items[cache->count++] = hndl;
+
+            res = TRUE;
+        }
+    }
+
+    if (OCILib.hdl_cache_mutex)
+    {
+        OCI_MutexRelease(OCILib.hdl_cache_mutex);
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HandleCacheResize
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_HandleCacheResize
+(
+    unsigned int size
+)
+{
+    ub4 i;
+
+    if (OCILib.hdl_cache_mutex)
+    {
+        OCI_MutexAcquire(OCILib.hdl_cache_mutex);
+    }
+
+    for (i = 0; i < OCI_HDL_CACHE_COUNT; i++)
+    {
+        OCI_HandleCache *cache = &OCILib.hdl_caches[i];
+
+        /* release idle handles exceeding the new size */
+
+        while (cache->count > size)
+        {
+            void *hndl = cache->items[--cache->count];
+
+            if (OCI_HTYPE_ERROR == HandleCacheTypes[i])
+            {
+                OCI_HandleFree(hndl, HandleCacheTypes[i]);
+            }
+            else
+            {
+                OCI_DescriptorFree(hndl, HandleCacheTypes[i]);
+            }
+        }
+
+        if (0 == size)
+        {
+            OCI_FREE(cache->items)
+        }
+        else if (cache->items)
+        {
+            cache->items = (void **) OCI_MemRealloc(cache->items, OCI_IPC_VOID,
+                                                    sizeof(*cache->items), (size_t) size);
+        }
+    }
+
+    OCILib.hdl_cache_size = size;
+
+    if (OCILib.hdl_cache_mutex)
+    {
+        OCI_MutexRelease(OCILib.hdl_cache_mutex);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HandleAllocCached
+ * --------------------------------------------------------------------------------------------- */
+
+sword OCI_HandleAllocCached
+(
+    CONST dvoid *parenth,
+    dvoid      **hndlpp,
+    CONST ub4    type
+)
+{
+    *hndlpp = OCI_HandleCachePop(OCI_HandleCacheGet(parenth, type));
+
+    OCI_CHECK(NULL != *hndlpp, OCI_SUCCESS)
+
+    return OCI_HandleAlloc(parenth, hndlpp, type, (size_t) 0, (dvoid **) NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_HandleFreeCached
+ * --------------------------------------------------------------------------------------------- */
+
+sword OCI_HandleFreeCached
+(
+    CONST dvoid *parenth,
+    dvoid       *hndlp,
+    CONST ub4    type
+)
+{
+    OCI_CHECK(NULL == hndlp, OCI_SUCCESS)
+    OCI_CHECK(OCI_HandleCachePush(OCI_HandleCacheGet(parenth, type), hndlp), OCI_SUCCESS)
+
+    return OCI_HandleFree(hndlp, type);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_DescriptorAllocCached
+ * --------------------------------------------------------------------------------------------- */
+
+sword OCI_DescriptorAllocCached
+(
+    CONST dvoid *parenth,
+    dvoid      **descpp,
+    CONST ub4    type
+)
+{
+    *descpp = OCI_HandleCachePop(OCI_HandleCacheGet(parenth, type));
+
+    OCI_CHECK(NULL != *descpp, OCI_SUCCESS)
+
+    return OCI_DescriptorAlloc(parenth, descpp, type, (size_t) 0, (dvoid **) NULL);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_DescriptorFreeCached
+ * --------------------------------------------------------------------------------------------- */
+
+sword OCI_DescriptorFreeCached
+(
+    CONST dvoid *parenth,
+    dvoid       *descp,
+    CONST ub4    type
+)
+{
+    OCI_CHECK(NULL == descp, OCI_SUCCESS)
+    OCI_CHECK(OCI_HandleCachePush(OCI_HandleCacheGet(parenth, type), descp), OCI_SUCCESS)
+
+    return OCI_DescriptorFree(descp, type);
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ObjectNew
  * --------------------------------------------------------------------------------------------- */
@@ -337,3 +839,130 @@ sword OCI_OCIObjectFree
     return ret;
 }
 
+/* ********************************************************************************************* *
+ *                             PUBLIC FUNCTIONS
+ * ********************************************************************************************* */
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetMemoryHandlers
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetMemoryHandlers
+(
+    POCI_MEM_ALLOC   alloc_fct,
+    POCI_MEM_REALLOC realloc_fct,
+    POCI_MEM_FREE    free_fct
+)
+{
+    /* memory allocated with the current handlers would be released with the new ones */
+
+    OCI_CHECK(OCILib.loaded, FALSE)
+
+    if (!alloc_fct && !realloc_fct && !free_fct)
+    {
+        MemAllocHandler   = malloc;
+        MemReallocHandler = realloc;
+        MemFreeHandler    = free;
+    }
+    else
+    {
+        OCI_CHECK(!alloc_fct || !realloc_fct || !free_fct, FALSE)
+
+        MemAllocHandler   = alloc_fct;
+        MemReallocHandler = realloc_fct;
+        MemFreeHandler    = free_fct;
+    }
+
+    return TRUE;
+}
+
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetHandleCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetHandleCacheSize
+(
+    unsigned int size
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_INITIALIZED()
+
+    OCI_HandleCacheResize(size);
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetHandleCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetHandleCacheSize
+(
+    void
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, 0)
+
+    OCI_CHECK_INITIALIZED()
+
+    call_retval = OCILib.hdl_cache_size;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetMemoryStats
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_GetMemoryStats
+(
+    unsigned int  type,
+    big_uint     *cur_bytes,
+    big_uint     *max_bytes,
+    unsigned int *cur_blocks,
+    big_uint     *nb_allocs
+)
+{
+    OCI_CHECK(!MemStatsEnabled, FALSE)
+    OCI_CHECK(type > OCI_IPC_COUNT, FALSE)
+
+    if (cur_bytes)
+    {
+        *cur_bytes = MemStats[type].cur_bytes;
+    }
+
+    if (max_bytes)
+    {
+        *max_bytes = MemStats[type].max_bytes;
+    }
+
+    if (cur_blocks)
+    {
+        *cur_blocks = MemStats[type].cur_blocks;
+    }
+
+    if (nb_allocs)
+    {
+        *nb_allocs = MemStats[type].nb_allocs;
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetMemoryTypeName
+ * --------------------------------------------------------------------------------------------- */
+
+const otext * OCI_API OCI_GetMemoryTypeName
+(
+    unsigned int type
+)
+{
+    return OCI_ExceptionGetTypeName((int) type);
+}
@@ -34,10 +34,756 @@
 
 #include "ocilib_internal.h"
 
+/* ********************************************************************************************* *
+ *                             PRIVATE VARIABLES
+ * ********************************************************************************************* */
+
+/* powers of ten that are exact doubles */
+
+static const double NumberPowers10[OCI_NUM_ORA_DBL_POW10 + 1] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 /* ********************************************************************************************* *
  *                             PRIVATE FUNCTIONS
  * ********************************************************************************************* */
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberUnpack
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberUnpack
+(
+    OCINumber *number,
+    boolean   *neg,
+    int       *exp,
+    ub1       *digits,
+    int       *count
+)
+{
+    ub1 *part = number->OCINumberPart;
+    int  len  = (int) part[0];
+    int  i;
+
+    OCI_CHECK((len < 1) || (len > OCI_NUM_ORA_MAX_DIGITS + 1), FALSE)
+
+    *neg   = FALSE;
+    *exp   = 0;
+    *count = 0;
+
+    /* zero is the only valid number without mantissa (a single 0 byte is -infinity) */
+
+    if (1 == len)
+    {
+        return (OCI_NUM_ORA_EXP_ZERO == part[1]);
+    }
+
+    if (part[1] & OCI_NUM_ORA_EXP_ZERO)
+    {
+        /* positive numbers store their digits as value + 1 */
+
+        *exp = (int) part[1] - OCI_NUM_ORA_EXP_POS;
+
+        for (i = 2; i <= len; i++)
+        {
+            OCI_CHECK((part[i] < 1) || (part[i] > 100), FALSE)
+
+            digits[(*count)++] = (ub1) (part[i] - 1);
+        }
+    }
+    else
+    {
+        /* negative numbers have a complemented exponent, store their digits as 101 - value
+           and terminate their mantissa with a 102 byte when it is not full */
+
+        *neg = TRUE;
+        *exp = OCI_NUM_ORA_EXP_NEG - (int) part[1];
+
+        if (OCI_NUM_ORA_NEG_TERM == part[len])
+        {
+            len--;
+        }
+
+        for (i = 2; i <= len; i++)
+        {
+            OCI_CHECK((part[i] < 2) || (part[i] > 101), FALSE)
+
+            digits[(*count)++] = (ub1) (101 - part[i]);
+        }
+    }
+
+    return (*count > 0);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberPack
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberPack
+(
+    OCINumber *number,
+    boolean    neg,
+    int        exp,
+    ub1       *digits,
+    int        count
+)
+{
+    ub1 *part = number->OCINumberPart;
+    int  i;
+
+    OCI_CHECK(count > OCI_NUM_ORA_MAX_DIGITS, FALSE)
+
+    if (0 == count)
+    {
+        part[0] = 1;
+        part[1] = OCI_NUM_ORA_EXP_ZERO;
+
+        return TRUE;
+    }
+
+    OCI_CHECK((exp < OCI_NUM_ORA_MIN_EXP) || (exp > OCI_NUM_ORA_MAX_EXP), FALSE)
+
+    part[0] = (ub1) (count + 1);
+    part[1] = (ub1) (neg ? OCI_NUM_ORA_EXP_NEG - exp : OCI_NUM_ORA_EXP_POS + exp);
+
+    for (i = 0; i < count; i++)
+    {
+        part[i + 2] = (ub1) (neg ? 101 - digits[i] : digits[i] + 1);
+    }
+
+    if (neg && (count < OCI_NUM_ORA_MAX_DIGITS))
+    {
+        part[count + 2] = OCI_NUM_ORA_NEG_TERM;
+        part[0]++;
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberDecodeInt
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberDecodeInt
+(
+    OCINumber *number,
+    uword      size,
+    uword      sign,
+    void      *out_value
+)
+{
+    ub1      digits[OCI_NUM_ORA_MAX_DIGITS];
+    big_uint value = 0;
+    big_uint limit = 0;
+    boolean  neg   = FALSE;
+    int      exp   = 0;
+    int      count = 0;
+    int      i;
+
+    OCI_CHECK(!OCI_NumberUnpack(number, &neg, &exp, digits, &count), FALSE)
+
+    /* values with a fractional part are left to OCINumberToInt() */
+
+    OCI_CHECK(count > exp + 1, FALSE)
+
+    for (i = 0; i <= exp; i++)
+    {
+        ub1 digit = (ub1) ((i < count) ? digits[i] : 0);
+
+        OCI_CHECK(value > (((big_uint) -1) - digit) / 100, FALSE)
+
+        value = value * 100 + digit;
+    }
+
+    /* out of range values are left to OCI that raises the appropriate error */
+
+    if (size >= sizeof(big_uint))
+    {
+        limit = (big_uint) -1;
+    }
+    else
+    {
+        limit = (((big_uint) 1) << (size * 8)) - 1;
+    }
+
+    if (OCI_NUMBER_SIGNED == sign)
+    {
+        big_int ival = 0;
+
+        limit = (limit >> 1) + (neg ? 1 : 0);
+
+        OCI_CHECK(value > limit, FALSE)
+
+        ival = neg ? -((big_int) (value - 1)) - 1 : (big_int) value;
+
+        if (sizeof(big_int) == size)
+        {
+            *((big_int *) out_value) = ival;
+        }
+        else if (sizeof(int) == size)
+        {
+            *((int *) out_value) = (int) ival;
+        }
+        else if (sizeof(short) == size)
+        {
+            *((short *) out_value) = (short) ival;
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+    else
+    {
+        OCI_CHECK(neg || (value > limit), FALSE)
+
+        if (sizeof(big_uint) == size)
+        {
+            *((big_uint *) out_value) = value;
+        }
+        else if (sizeof(unsigned int) == size)
+        {
+            *((unsigned int *) out_value) = (unsigned int) value;
+        }
+        else if (sizeof(unsigned short) == size)
+        {
+            *((unsigned short *) out_value) = (unsigned short) value;
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberEncodeInt
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberEncodeInt
+(
+    OCINumber *number,
+    uword      size,
+    uword      sign,
+    void      *in_value
+)
+{
+    ub1      digits[OCI_NUM_ORA_MAX_DIGITS];
+    big_uint value = 0;
+    boolean  neg   = FALSE;
+    int      exp   = -1;
+    int      count = 0;
+    int      i;
+
+    if (OCI_NUMBER_SIGNED == sign)
+    {
+        big_int ival = 0;
+
+        if (sizeof(big_int) == size)
+        {
+            ival = *((big_int *) in_value);
+        }
+        else if (sizeof(int) == size)
+        {
+            ival = *((int *) in_value);
+        }
+        else if (sizeof(short) == size)
+        {
+            ival = *((short *) in_value);
+        }
+        else
+        {
+            return FALSE;
+        }
+
+        neg   = (ival < 0);
+        value = neg ? ((big_uint) -(ival + 1)) + 1 : (big_uint) ival;
+    }
+    else
+    {
+        if (sizeof(big_uint) == size)
+        {
+            value = *((big_uint *) in_value);
+        }
+        else if (sizeof(unsigned int) == size)
+        {
+            value = *((unsigned int *) in_value);
+        }
+        else if (sizeof(unsigned short) == size)
+        {
+            value = *((unsigned short *) in_value);
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    /* base 100 digits are extracted from the least significant one */
+
+    while (value > 0)
+    {
+        digits[++exp] = (ub1) (value % 100);
+        value        /= 100;
+    }
+
+    /* then reversed without trailing zero digits */
+
+    for (i = 0; i < (exp + 1) / 2; i++)
+    {
+        ub1 digit = digits[i];
+
+        digits[i]       = digits[exp - i];
+        digits[exp - i] = digit;
+    }
+
+    for (count = exp + 1; (count > 0) && (0 == digits[count - 1]); count--)
+    {
+        /* nothing */
+    }
+
+    return OCI_NumberPack(number, neg, exp, digits, count);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberDecodeReal
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberDecodeReal
+(
+    OCINumber *number,
+    double    *out_value
+)
+{
+    ub1     digits[OCI_NUM_ORA_MAX_DIGITS];
+    double  value = 0.0;
+    boolean neg   = FALSE;
+    int     exp   = 0;
+    int     count = 0;
+    int     scale = 0;
+    int     i;
+
+    OCI_CHECK(!OCI_NumberUnpack(number, &neg, &exp, digits, &count), FALSE)
+
+    /* only values whose mantissa and power of ten are both exact doubles are decoded here,
+       as a single IEEE multiplication or division then gives the correctly rounded result */
+
+    OCI_CHECK(count > OCI_NUM_ORA_DBL_DIGITS, FALSE)
+
+    for (i = 0; i < count; i++)
+    {
+        value = value * 100.0 + (double) digits[i];
+    }
+
+    OCI_CHECK(value >= 9007199254740992.0, FALSE)
+
+    scale = (count > 0) ? 2 * (exp - count + 1) : 0;
+
+    OCI_CHECK((scale > OCI_NUM_ORA_DBL_POW10) || (scale < -OCI_NUM_ORA_DBL_POW10), FALSE)
+
+    if (scale >= 0)
+    {
+        value *= NumberPowers10[scale];
+    }
+    else
+    {
+        value /= NumberPowers10[-scale];
+    }
+
+    *out_value = neg ? -value : value;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberEncodeReal
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberEncodeReal
+(
+    OCINumber *number,
+    double     in_value
+)
+{
+    ub1      decimals[OCI_NUM_ORA_DBL_SIG_DIGITS];
+    ub1      digits[OCI_NUM_ORA_DBL_SIG_DIGITS / 2 + 1];
+    double   value  = (in_value < 0.0) ? -in_value : in_value;
+    double   check  = 0.0;
+    big_uint mant   = 0;
+    big_uint low    = 1;
+    boolean  neg    = (in_value < 0.0);
+    int      scale  = OCI_NUM_ORA_DBL_SIG_DIGITS - 1;
+    int      pow10  = 0;
+    int      count  = 0;
+    int      i;
+
+    if (0.0 == value)
+    {
+        return OCI_NumberPack(number, FALSE, 0, digits, 0);
+    }
+
+    /* NaN, infinite and values whose scaling is not a single exact power of ten are left to
+       OCINumberFromReal(). This test is written so that NaN fails it */
+
+    OCI_CHECK(!((value >= 1e-8) && (value < 1e37)), FALSE)
+
+    for (i = 1; i < OCI_NUM_ORA_DBL_SIG_DIGITS; i++)
+    {
+        low *= 10;
+    }
+
+    /* round the value to 15 significant decimal digits : mant * 10^-scale */
+
+    for (;;)
+    {
+        double scaled = 0.0;
+
+        OCI_CHECK((scale > OCI_NUM_ORA_DBL_POW10) || (scale < -OCI_NUM_ORA_DBL_POW10), FALSE)
+
+        if (scale >= 0)
+        {
+            scaled = value * NumberPowers10[scale];
+        }
+        else
+        {
+            scaled = value / NumberPowers10[-scale];
+        }
+
+        /* the range is checked before converting, to rule out overflows */
+
+        if (scaled + 0.5 >= (double) (low * 10))
+        {
+            scale--;
+        }
+        else if (scaled + 0.5 < (double) low)
+        {
+            scale++;
+        }
+        else
+        {
+            mant = (big_uint) (scaled + 0.5);
+            break;
+        }
+    }
+
+    pow10 = OCI_NUM_ORA_DBL_SIG_DIGITS - 1 - scale;
+
+    for (i = OCI_NUM_ORA_DBL_SIG_DIGITS - 1; i >= 0; i--)
+    {
+        decimals[i] = (ub1) (mant % 10);
+        mant       /= 10;
+    }
+
+    /* group the decimal digits by pairs aligned on even powers of ten. The leading digit
+       is the low one of its pair when its power of ten is even */
+
+    for (i = (pow10 & 1) ? 0 : -1; i < OCI_NUM_ORA_DBL_SIG_DIGITS; i += 2)
+    {
+        int high = (i >= 0) ? decimals[i] : 0;
+        int next = (i + 1 < OCI_NUM_ORA_DBL_SIG_DIGITS) ? decimals[i + 1] : 0;
+
+        digits[count++] = (ub1) (high * 10 + next);
+    }
+
+    while ((count > 0) && (0 == digits[count - 1]))
+    {
+        count--;
+    }
+
+    OCI_CHECK(!OCI_NumberPack(number, neg, (pow10 - (pow10 & 1)) / 2, digits, count), FALSE)
+
+    /* 15 digits decimals are at least 4 times as far apart as doubles, so at most one of them
+       converts back to the value. When it does, it is the shortest decimal form of the value
+       and the one OCI returns. Other values are left to OCINumberFromReal() */
+
+    OCI_CHECK(!OCI_NumberDecodeReal(number, &check), FALSE)
+
+    return (check == in_value);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberDecodeText
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberDecodeText
+(
+    OCINumber *number,
+    otext     *out_value,
+    int       *out_value_size
+)
+{
+    ub1     digits[OCI_NUM_ORA_MAX_DIGITS];
+    otext  *str   = out_value;
+    boolean neg   = FALSE;
+    int     exp   = 0;
+    int     count = 0;
+    int     i;
+
+    /* output matches OCI_STRING_FORMAT_NUM, whatever the value */
+
+    OCI_CHECK(*out_value_size <= OCI_NUM_ORA_TXT_INT_DIGITS + OCI_NUM_ORA_TXT_DEC_DIGITS + 2, FALSE)
+
+    OCI_CHECK(!OCI_NumberUnpack(number, &neg, &exp, digits, &count), FALSE)
+
+    /* values that the format would overflow or round are left to OCINumberToText() */
+
+    if ((exp >= 0) && (count > 0))
+    {
+        OCI_CHECK(2 * (exp + 1) - (digits[0] < 10 ? 1 : 0) > OCI_NUM_ORA_TXT_INT_DIGITS, FALSE)
+    }
+
+    if (count - 1 > exp)
+    {
+        OCI_CHECK(2 * (count - 1 - exp) - (digits[count - 1] % 10 ? 0 : 1) > OCI_NUM_ORA_TXT_DEC_DIGITS, FALSE)
+    }
+
+    if (neg)
+    {
+        *str++ = OTEXT('-');
+    }
+
+    /* integer part */
+
+    if (exp < 0)
+    {
+        *str++ = OTEXT('0');
+    }
+
+    for (i = 0; i <= exp; i++)
+    {
+        ub1 digit = (ub1) ((i < count) ? digits[i] : 0);
+
+        if ((i > 0) || (digit >= 10))
+        {
+            *str++ = (otext) (OTEXT('0') + digit / 10);
+        }
+
+        *str++ = (otext) (OTEXT('0') + digit % 10);
+    }
+
+    /* fractional part without trailing zeros */
+
+    if (count - 1 > exp)
+    {
+        *str++ = OTEXT('.');
+
+        for (i = exp + 1; i < count; i++)
+        {
+            ub1 digit = (ub1) ((i >= 0) ? digits[i] : 0);
+
+            *str++ = (otext) (OTEXT('0') + digit / 10);
+
+            if ((i < count - 1) || (digit % 10))
+            {
+                *str++ = (otext) (OTEXT('0') + digit % 10);
+            }
+        }
+    }
+
+    *str = 0;
+
+    *out_value_size = (int) (str - out_value);
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberEncodeText
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberEncodeText
+(
+    OCINumber   *number,
+    const otext *in_value
+)
+{
+    ub1          digits[(OCI_NUM_ORA_TXT_INT_DIGITS + OCI_NUM_ORA_TXT_DEC_DIGITS) / 2 + 1];
+    const otext *str     = in_value;
+    const otext *int_str = NULL;
+    const otext *dec_str = NULL;
+    boolean      neg     = FALSE;
+    int          nb_int  = 0;
+    int          nb_dec  = 0;
+    int          first   = 0;
+    int          count   = 0;
+    int          exp     = 0;
+    int          i;
+
+    /* only plain decimal strings "[-]digits[.digits]" are parsed here */
+
+    if (OTEXT('-') == *str)
+    {
+        neg = TRUE;
+        str++;
+    }
+
+    while ((OTEXT('0') == str[0]) && (str[1] >= OTEXT('0')) && (str[1] <= OTEXT('9')))
+    {
+        str++;
+    }
+
+    for (int_str = str; (*str >= OTEXT('0')) && (*str <= OTEXT('9')); str++)
+    {
+        nb_int++;
+    }
+
+    OCI_CHECK((0 == nb_int) || (nb_int > OCI_NUM_ORA_TXT_INT_DIGITS), FALSE)
+
+    if (OTEXT('.') == *str)
+    {
+        for (dec_str = ++str; (*str >= OTEXT('0')) && (*str <= OTEXT('9')); str++)
+        {
+            nb_dec++;
+        }
+
+        OCI_CHECK((0 == nb_dec) || (nb_dec > OCI_NUM_ORA_TXT_DEC_DIGITS), FALSE)
+    }
+
+    OCI_CHECK(0 != *str, FALSE)
+
+    /* group decimal digits by pairs on each side of the decimal point */
+
+    for (i = (nb_int % 2) ? -1 : 0; i < nb_int; i += 2)
+    {
+        int high = (i >= 0) ? int_str[i] - OTEXT('0') : 0;
+
+        digits[count++] = (ub1) (high * 10 + int_str[i + 1] - OTEXT('0'));
+    }
+
+    exp = count - 1;
+
+    for (i = 0; i < nb_dec; i += 2)
+    {
+        int low = (i + 1 < nb_dec) ? dec_str[i + 1] - OTEXT('0') : 0;
+
+        digits[count++] = (ub1) ((dec_str[i] - OTEXT('0')) * 10 + low);
+    }
+
+    /* strip leading and trailing zero digits */
+
+    for (first = 0; (first < count) && (0 == digits[first]); first++)
+    {
+        exp--;
+    }
+
+    while ((count > first) && (0 == digits[count - 1]))
+    {
+        count--;
+    }
+
+    count -= first;
+
+    /* longer mantissas may be rounded by OCINumberFromText() */
+
+    OCI_CHECK(count > OCI_NUM_ORA_TXT_DIGITS, FALSE)
+
+    return OCI_NumberPack(number, neg, exp, digits + first, count);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_NumberGetNative
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_NumberGetNative
+(
+    OCI_Connection *con,
+    void           *number,
+    uword           type,
+    int             sqlcode,
+    void           *out_value
+)
+{
+    boolean res  = TRUE;
+    big_int ival = 0;
+    double  dval = 0.0;
+
+    OCI_CHECK(NULL == con, FALSE)
+    OCI_CHECK(NULL == number, FALSE)
+    OCI_CHECK(NULL == out_value, FALSE)
+
+    /* read the native value from the buffer */
+
+    if (SQLT_INT == sqlcode)
+    {
+        ival = *((big_int *) number);
+        dval = (double) ival;
+    }
+    else if (SQLT_UIN == sqlcode)
+    {
+        ival = (big_int) *((big_uint *) number);
+        dval = (double) *((big_uint *) number);
+    }
+    else if (SQLT_BFLOAT == sqlcode)
+    {
+        dval = (double) *((float *) number);
+        ival = (big_int) dval;
+    }
+    else
+    {
+        dval = *((double *) number);
+        ival = (big_int) dval;
+    }
+
+    /* and perform a C based conversion to the requested type */
+
+    if (OCI_NUM_NUMBER == type)
+    {
+        if ((SQLT_INT == sqlcode) || (SQLT_UIN == sqlcode))
+        {
+            uword sign = (SQLT_UIN == sqlcode) ? OCI_NUMBER_UNSIGNED : OCI_NUMBER_SIGNED;
+
+            OCI_CALL2
+            (
+                res, con,
+
+                OCINumberFromInt(con->err, &ival, sizeof(ival), sign, (OCINumber *) out_value)
+            )
+        }
+        else
+        {
+            if (!OCI_NumberEncodeReal((OCINumber *) out_value, dval))
+            {
+                OCI_CALL2
+                (
+                    res, con,
+
+                    OCINumberFromReal(con->err, &dval, sizeof(dval), (OCINumber *) out_value)
+                )
+            }
+        }
+    }
+    else if (type & OCI_NUM_DOUBLE)
+    {
+        *((double *) out_value) = dval;
+    }
+    else if (type & OCI_NUM_FLOAT)
+    {
+        *((float *) out_value) = (float) dval;
+    }
+    else if (type & OCI_NUM_BIGINT)
+    {
+        *((big_int *) out_value) = ival;
+    }
+    else if (type & OCI_NUM_INT)
+    {
+        *((int *) out_value) = (int) ival;
+    }
+    else if (type & OCI_NUM_SHORT)
+    {
+        *((short *) out_value) = (short) ival;
+    }
+    else
+    {
+        res = FALSE;
+    }
+
+    return res;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_NumberGet
  * --------------------------------------------------------------------------------------------- */
@@ -58,9 +804,20 @@ boolean OCI_NumberGet
     OCI_CHECK(NULL == number, FALSE)
     OCI_CHECK(NULL == out_value, FALSE)
 
-#if OCI_VERSION_COMPILE < OCI_10_1
+    /* native integers come from NUMBER columns defined in OCI_NDM_NATIVE mode
+       and from big integers registered for RETURNING clauses */
 
-    OCI_NOT_USED(sqlcode)
+    if ((SQLT_INT == sqlcode) || (SQLT_UIN == sqlcode))
+    {
+        return OCI_NumberGetNative(con, number, type, sqlcode, out_value);
+    }
+
+#if OCI_VERSION_COMPILE >= OCI_10_1
+
+    if ((OCILib.version_runtime >= OCI_10_1) && ((SQLT_BDOUBLE == sqlcode) || (SQLT_BFLOAT == sqlcode)))
+    {
+        return OCI_NumberGetNative(con, number, type, sqlcode, out_value);
+    }
 
 #endif
 
@@ -70,29 +827,9 @@ boolean OCI_NumberGet
     }
     else if (type & OCI_NUM_DOUBLE || type & OCI_NUM_FLOAT)
     {
+        /* OCI is only called for values that cannot be decoded exactly */
 
-    #if OCI_VERSION_COMPILE >= OCI_10_1
-
-        if ((OCILib.version_runtime >= OCI_10_1) && ((sqlcode != SQLT_VNU)))
-        {
-            if (((type & OCI_NUM_DOUBLE) && (SQLT_BDOUBLE == sqlcode)) ||
-                ((type & OCI_NUM_FLOAT ) && (SQLT_BFLOAT  == sqlcode)))
-            {
-                memcpy(out_value, number, size);
-            }
-            else if (type & OCI_NUM_DOUBLE && (SQLT_BFLOAT == sqlcode))
-            {
-                *((double *) out_value) = (double) *((float *) number);
-            }
-            else if (type & OCI_NUM_FLOAT && (SQLT_BDOUBLE == sqlcode))
-            {
-                 *((float *) out_value) = (float) *((double *) number);
-            }
-        }
-        else
-
-    #endif
-
+        if ((sizeof(double) != size) || !OCI_NumberDecodeReal((OCINumber *) number, (double *) out_value))
         {
             OCI_CALL2
             (
@@ -106,12 +843,15 @@ boolean OCI_NumberGet
     {
         uword sign = (type & OCI_NUM_UNSIGNED) ? OCI_NUMBER_UNSIGNED : OCI_NUMBER_SIGNED;
 
-        OCI_CALL2
-        (
-            res, con,
+        if (!OCI_NumberDecodeInt((OCINumber *) number, size, sign, out_value))
+        {
+            OCI_CALL2
+            (
+                res, con,
 
-            OCINumberToInt(con->err, (OCINumber *) number, size, sign, out_value)
-        )
+                OCINumberToInt(con->err, (OCINumber *) number, size, sign, out_value)
+            )
+        }
     }
 
     return res;
@@ -169,24 +909,32 @@ boolean OCI_NumberSet
     #endif
 
         {
-            OCI_CALL2
-            (
-                res, con,
+            /* OCI is only called for values that cannot be encoded exactly */
 
-                OCINumberFromReal(con->err, in_value, size, (OCINumber *) number)
-            )
+            if ((sizeof(double) != size) || !OCI_NumberEncodeReal((OCINumber *) number, *((double *) in_value)))
+            {
+                OCI_CALL2
+                (
+                    res, con,
+
+                    OCINumberFromReal(con->err, in_value, size, (OCINumber *) number)
+                )
+            }
         }
     }
     else
     {
         uword sign = (type & OCI_NUM_UNSIGNED) ? OCI_NUMBER_UNSIGNED : OCI_NUMBER_SIGNED;
 
-        OCI_CALL2
-        (
-            res, con,
+        if (!OCI_NumberEncodeInt((OCINumber *) number, size, sign, in_value))
+        {
+            OCI_CALL2
+            (
+                res, con,
 
-            OCINumberFromInt(con->err, in_value, size, sign, (OCINumber *) number)
-        )
+                OCINumberFromInt(con->err, in_value, size, sign, (OCINumber *) number)
+            )
+        }
     }
 
     return res;
@@ -211,6 +959,8 @@ boolean OCI_NumberFromString
     boolean res  = TRUE;
     boolean done = FALSE;
 
+    OCI_NOT_USED(sqlcode)
+
     /* For binary types, perform a C based conversion */
 
     if (type & OCI_NUM_DOUBLE || type & OCI_NUM_FLOAT)
@@ -253,23 +1003,28 @@ boolean OCI_NumberFromString
             fmt = OCI_GetFormat(con, OCI_FMT_NUMERIC);
         }
 
-        dbstr1 = OCI_StringGetOracleString(in_value, &dbsize1);
-        dbstr2 = OCI_StringGetOracleString(fmt, &dbsize2);
-
         memset(&number, 0, sizeof(number));
 
-        OCI_CALL2
-        (
-            res, con,
+        /* plain decimal strings using the default format are encoded without calling OCI */
 
-            OCINumberFromText(con->err, (oratext *) dbstr1, (ub4) dbsize1, (oratext *) dbstr2,
-                                (ub4) dbsize2, (oratext *) NULL,  (ub4) 0, (OCINumber *) &number)
-        )
+        if (!fmt || ostrcmp(fmt, OCI_STRING_FORMAT_NUM) || !OCI_NumberEncodeText(&number, in_value))
+        {
+            dbstr1 = OCI_StringGetOracleString(in_value, &dbsize1);
+            dbstr2 = OCI_StringGetOracleString(fmt, &dbsize2);
 
-        OCI_StringReleaseOracleString(dbstr2);
-        OCI_StringReleaseOracleString(dbstr1);
+            OCI_CALL2
+            (
+                res, con,
+
+                OCINumberFromText(con->err, (oratext *) dbstr1, (ub4) dbsize1, (oratext *) dbstr2,
+                                    (ub4) dbsize2, (oratext *) NULL,  (ub4) 0, (OCINumber *) &number)
+            )
+
+            OCI_StringReleaseOracleString(dbstr2);
+            OCI_StringReleaseOracleString(dbstr1);
+        }
 
-        res = res && OCI_NumberGet(con, (void *) &number, size, type, sqlcode, out_value);
+        res = res && OCI_NumberGet(con, (void *) &number, size, type, SQLT_VNU, out_value);
     }
 
     return res;
@@ -292,6 +1047,7 @@ boolean OCI_NumberToString
 {
     boolean res  = TRUE;
     boolean done = FALSE;
+    OCINumber num;
 
     out_value[0] = 0;
 
@@ -339,6 +1095,41 @@ boolean OCI_NumberToString
 
     }
 
+    /* native integers are converted to an OCINumber to honor the numeric format */
+
+    if ((SQLT_INT == sqlcode) || (SQLT_UIN == sqlcode))
+    {
+        big_int value = *((big_int *) number);
+        uword   sign  = (SQLT_UIN == sqlcode) ? OCI_NUMBER_UNSIGNED : OCI_NUMBER_SIGNED;
+
+        if (!OCI_NumberEncodeInt(&num, sizeof(value), sign, &value))
+        {
+            OCI_CALL2
+            (
+                res, con,
+
+                OCINumberFromInt(con->err, &value, sizeof(value), sign, &num)
+            )
+        }
+
+        number = &num;
+    }
+
+    /* the default format is a plain decimal output that does not need OCI */
+
+    if (!done)
+    {
+        if (!fmt)
+        {
+            fmt = OCI_GetFormat(con, OCI_FMT_NUMERIC);
+        }
+
+        if (fmt && !ostrcmp(fmt, OCI_STRING_FORMAT_NUM))
+        {
+            done = OCI_NumberDecodeText((OCINumber *) number, out_value, &out_value_size);
+        }
+    }
+
     /* use OCINumber conversion if not processed yet */
 
     if (!done)
@@ -348,11 +1139,6 @@ boolean OCI_NumberToString
         int     dbsize1 = out_value_size * (int) sizeof(otext);
         int     dbsize2 = -1;
 
-        if (!fmt)
-        {
-            fmt = OCI_GetFormat(con, OCI_FMT_NUMERIC);
-        }
-
         dbstr1 = OCI_StringGetOracleString(out_value, &dbsize1);
         dbstr2 = OCI_StringGetOracleString(fmt, &dbsize2);
 
@@ -345,7 +345,7 @@ OCI_Object * OCI_ObjectInit
         }
         else
         {
-            OCI_ObjectReset(obj);
+            OCI_ObjectReset(obj, TRUE);
         }
 
         res = (NULL != obj->objs);
@@ -434,7 +434,8 @@ OCI_Object * OCI_ObjectInit
 
 void OCI_ObjectReset
 (
-    OCI_Object *obj
+    OCI_Object *obj,
+    boolean     recycle
 )
 {
     ub2 i;
@@ -450,14 +451,32 @@ void OCI_ObjectReset
         {
             OCI_Datatype * data = (OCI_Datatype *) obj->objs[i];
 
-            if (OCI_OBJECT_FETCHED_CLEAN == data->hstate)
+            /* when the object is rebound to another instance (next fetched row), wrappers of
+               fetched attributes only reference the previous instance memory. Thus they are
+               kept to be rebound by the next attribute access instead of being freed and
+               allocated again. References are not kept as they may hold a pinned object */
+
+            if (recycle && (OCI_OBJECT_FETCHED_CLEAN == data->hstate) &&
+                (OCI_CDT_REF != obj->typinf->cols[i].datatype))
             {
-                data->hstate =  OCI_OBJECT_FETCHED_DIRTY;
+                if (OCI_CDT_OBJECT == obj->typinf->cols[i].datatype)
+                {
+                    /* indicators of sub objects must be retrieved again from the parent */
+
+                    ((OCI_Object *) data)->tab_ind = NULL;
+                }
             }
+            else
+            {
+                if (OCI_OBJECT_FETCHED_CLEAN == data->hstate)
+                {
+                    data->hstate =  OCI_OBJECT_FETCHED_DIRTY;
+                }
+
+                OCI_FreeObjectFromType(obj->objs[i], obj->typinf->cols[i].datatype);
 
-            OCI_FreeObjectFromType(obj->objs[i], obj->typinf->cols[i].datatype);
-            
-            obj->objs[i] = NULL;
+                obj->objs[i] = NULL;
+            }
         }
     }
 }
@@ -665,7 +684,7 @@ boolean OCI_API OCI_ObjectFree
     /* if the object has sub-objects that have been fetched, we need to free
        these objects */
 
-    OCI_ObjectReset(obj);
+    OCI_ObjectReset(obj, FALSE);
 
     if (obj->objs)
     {
@@ -769,7 +788,7 @@ boolean OCI_API OCI_ObjectAssign
     {
         obj->typinf = obj_src->typinf;
 
-        OCI_ObjectReset(obj);
+        OCI_ObjectReset(obj, FALSE);
     }
 
     call_retval = call_status;
@@ -683,6 +683,12 @@ typedef sword (*OCIBREAK)
     OCIError *errhp
 );
 
+typedef sword (*OCIRESET)
+(
+    dvoid    *hndlp,
+    OCIError *errhp
+);
+
 typedef sword (*OCIATTRGET)
 (
     const void *trgthndlp,
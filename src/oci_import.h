@@ -152,6 +152,7 @@ extern OCILOBLOADFROMFILE           OCILobLoadFromFile;
 extern OCILOBWRITEAPPEND            OCILobWriteAppend;
 extern OCISERVERVERSION             OCIServerVersion;
 extern OCIBREAK                     OCIBreak;
+extern OCIRESET                     OCIReset;
 extern OCIATTRGET                   OCIAttrGet;
 extern OCIATTRSET                   OCIAttrSet;
 extern OCIDATEASSIGN                OCIDateAssign;
@@ -410,6 +410,22 @@
     }                                                                          \
 
 
+/**
+ * @brief
+ * Checks if no other non blocking call is pending on the given connection
+ *
+ * @param con     - Connection handle
+ * @param st      - Statement handle
+ * @param resumed - Is the call resuming its own pending call ?
+ *
+ * @note
+ * Throws an exception if the connection is in non blocking mode and the call
+ * is not resuming its own pending call.
+ *
+ */
+
+#define OCI_CHECK_NON_BLOCKING_PENDING(con, st, resumed)                                                                                                          if ((con)->nb_mode && !(resumed))                                              {                                                                                  OCI_ExceptionAsyncPending((con), (st));                                        goto ExitCall;                                                             }                                                                          
+
 /**
  * @brief
  * Checks if the given statement is scrollable
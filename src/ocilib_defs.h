@@ -234,8 +234,14 @@
 #define OCI_IPC_DP_COL_ARRAY     60
 #define OCI_IPC_BATCH_ERRORS     61
 #define OCI_IPC_STATEMENT_ARRAY  62
+#define OCI_IPC_FIELD_LAYOUT     63
+#define OCI_IPC_FETCH_WINDOW     64
+#define OCI_IPC_PARTITION_ARRAY  65
+#define OCI_IPC_STMT_CACHE_ARRAY 66
+#define OCI_IPC_PLACEHOLDER_ARRAY 67
+#define OCI_IPC_ARENA_CHUNK      68
 
-#define OCI_IPC_COUNT            OCI_IPC_STATEMENT_ARRAY
+#define OCI_IPC_COUNT            OCI_IPC_ARENA_CHUNK
 
 /* --------------------------------------------------------------------------------------------- *
  * Oracle conditionnal features
@@ -260,8 +266,9 @@
 #define OCI_HDLE_HANDLE                 1
 #define OCI_HDLE_DESCRIPTOR             2
 #define OCI_HDLE_OBJECT                 3
+#define OCI_HDLE_MEMORY                 4
 
-#define OCI_HDLE_COUNT                  OCI_HDLE_OBJECT
+#define OCI_HDLE_COUNT                  OCI_HDLE_MEMORY
 
 /* --------------------------------------------------------------------------------------------- *
  * statement status
@@ -401,6 +408,17 @@
 
 #define OCI_FREE(ptr)                   OCI_MemFree(ptr), ptr = NULL;
 
+/* bind plan : work to perform on a bind at execute time */
+
+#define OCI_BPL_NONE             0
+#define OCI_BPL_CURSOR           1
+#define OCI_BPL_LENGTHS          2
+#define OCI_BPL_CONVERT          4
+#define OCI_BPL_NULLS            8
+#define OCI_BPL_OBJECT           16
+
+#define OCI_BPL_VALUES           (OCI_BPL_CONVERT | OCI_BPL_NULLS | OCI_BPL_OBJECT)
+
 /* indicator and nullity handlers */
 
 #define OCI_IND(exp)                    (sb2) ((exp) ? 0 : -1)  
@@ -483,10 +501,45 @@ OCI_LIB_CALL_EXIT()\
 
 #define OCI_DEFAUT_STMT_CACHE_SIZE     20
 
+#define OCI_HASH_MIN_SIZE              8
+
+#define OCI_ARENA_CHUNK_SIZE           4096
+#define OCI_ARENA_ALIGN(s)             (((s) + (2 * sizeof(void *)) - 1) & ~((2 * sizeof(void *)) - 1))
+
+#define OCI_LIST_ITEM_SIZE             OCI_ARENA_ALIGN(sizeof(OCI_Item))
+#define OCI_MEM_HEADER_SIZE            OCI_ARENA_ALIGN(sizeof(OCI_MemHeader))
+
+#define OCI_HDL_CACHE_COUNT            7
+#define OCI_DEFAULT_HDL_CACHE_SIZE     16
+
 #define WCHAR_2_BYTES   0xFFFF
 #define WCHAR_4_BYTES   0x7FFFFFFF
 
 #define SCALE_FLOAT     -127
 
+/* max number of decimal digits of NUMBER columns that can be fetched as native types */
+
+#define OCI_NUM_NATIVE_INT_DIGITS   ((sizeof(big_int) >= sizeof(sb8)) ? 18 : 9)
+#define OCI_NUM_NATIVE_DBL_DIGITS   15
+
+/* Oracle NUMBER internal format : length byte, exponent byte, base 100 mantissa */
+
+#define OCI_NUM_ORA_MAX_DIGITS      20
+#define OCI_NUM_ORA_MIN_EXP         -65
+#define OCI_NUM_ORA_MAX_EXP         62
+#define OCI_NUM_ORA_EXP_ZERO        0x80
+#define OCI_NUM_ORA_EXP_POS         0xC1
+#define OCI_NUM_ORA_EXP_NEG         0x3E
+#define OCI_NUM_ORA_NEG_TERM        102
+
+/* limits of the values converted without calling OCI */
+
+#define OCI_NUM_ORA_DBL_DIGITS      8
+#define OCI_NUM_ORA_DBL_POW10       22
+#define OCI_NUM_ORA_DBL_SIG_DIGITS  15
+#define OCI_NUM_ORA_TXT_DIGITS      19
+#define OCI_NUM_ORA_TXT_INT_DIGITS  38
+#define OCI_NUM_ORA_TXT_DEC_DIGITS  24
+
 #endif    /* OCILIB_OCILIB_DEFS_H_INCLUDED */
 
@@ -116,6 +116,11 @@ boolean OCI_BindAllocData
     OCI_Bind *bnd
 );
 
+boolean OCI_BindSetPlan
+(
+    OCI_Bind *bnd
+);
+
 boolean OCI_BindSetNullIndicator
 (
     OCI_Bind    *bnd,
@@ -284,6 +289,28 @@ boolean OCI_ConnectionClose
     OCI_Connection *con
 );
 
+unsigned int OCI_StatementCacheHash
+(
+    const otext *sql
+);
+
+boolean OCI_StatementCacheEvict
+(
+    OCI_Connection *con
+);
+
+boolean OCI_StatementCacheRemove
+(
+    OCI_Connection *con,
+    OCI_Statement  *stmt
+);
+
+boolean OCI_ConnectionSetNonBlocking
+(
+    OCI_Connection *con,
+    boolean         value
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * date.c
  * --------------------------------------------------------------------------------------------- */
@@ -338,6 +365,12 @@ void * OCI_DefineGetData
     OCI_Define *def
 );
 
+boolean OCI_DefineExpandString
+(
+    OCI_Define *def,
+    ub4         index
+);
+
 boolean OCI_DefineIsDataNotNull
 (
     OCI_Define *def
@@ -443,6 +476,11 @@ boolean OCI_EventReset
  * exception.c
  * --------------------------------------------------------------------------------------------- */
 
+const otext * OCI_ExceptionGetTypeName
+(
+    int type
+);
+
 OCI_Error * OCI_ExceptionGetError
 (
     void
@@ -627,6 +665,17 @@ void OCI_ExceptionArgInvalidValue
     unsigned int    value
 );
 
+void OCI_ExceptionAsyncPending
+(
+    OCI_Connection *con,
+    OCI_Statement  *stmt
+);
+
+void OCI_ExceptionForward
+(
+    OCI_Error *src
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * file.c
  * --------------------------------------------------------------------------------------------- */
@@ -656,14 +705,49 @@ int OCI_ParseSqlFmt
     va_list       *pargs
 );
 
+void * OCI_FormatStore
+(
+    OCI_Statement *stmt,
+    const void    *value,
+    size_t         size
+);
+
+boolean OCI_FormatBind
+(
+    OCI_Statement *stmt,
+    const otext  **pformat,
+    va_list       *pargs,
+    unsigned int   index,
+    boolean        bind
+);
+
+boolean OCI_BindSqlFmt
+(
+    OCI_Statement *stmt,
+    const otext   *format,
+    va_list       *pargs
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * hash.c
  * --------------------------------------------------------------------------------------------- */
 
 unsigned int OCI_HashCompute
 (
-    OCI_HashTable *table,
-    const otext   *str
+    const otext *str
+);
+
+OCI_HashSlot * OCI_HashFindSlot
+(
+    OCI_HashSlot *items,
+    unsigned int  size,
+    const otext  *key,
+    unsigned int  hash
+);
+
+boolean OCI_HashGrow
+(
+    OCI_HashTable *table
 );
 
 boolean OCI_HashAdd
@@ -863,6 +947,47 @@ void OCI_MemFree
     void * ptr_mem
 );
 
+void OCI_MemStatsInit
+(
+    boolean enabled
+);
+
+void OCI_MemStatsUpdate
+(
+    int    ptr_type,
+    size_t size_old,
+    size_t size_new,
+    int    nb_blocks
+);
+
+unsigned int OCI_MemStatsGetBlocks
+(
+    void
+);
+
+void * OCI_ArenaAlloc
+(
+    OCI_Arena *arena,
+    size_t     block_size,
+    size_t     block_count
+);
+
+otext * OCI_ArenaStrdup
+(
+    OCI_Arena   *arena,
+    const otext *str
+);
+
+void OCI_ArenaReset
+(
+    OCI_Arena *arena
+);
+
+void OCI_ArenaFree
+(
+    OCI_Arena *arena
+);
+
 sword OCI_HandleAlloc
 (
     CONST dvoid *parenth,
@@ -910,6 +1035,56 @@ sword OCI_DescriptorArrayFree
     ub4       nb_elem
 );
 
+OCI_HandleCache * OCI_HandleCacheGet
+(
+    CONST dvoid *parenth,
+    CONST ub4    type
+);
+
+void * OCI_HandleCachePop
+(
+    OCI_HandleCache *cache
+);
+
+boolean OCI_HandleCachePush
+(
+    OCI_HandleCache *cache,
+    void            *hndl
+);
+
+void OCI_HandleCacheResize
+(
+    unsigned int size
+);
+
+sword OCI_HandleAllocCached
+(
+    CONST dvoid *parenth,
+    dvoid      **hndlpp,
+    CONST ub4    type
+);
+
+sword OCI_HandleFreeCached
+(
+    CONST dvoid *parenth,
+    dvoid       *hndlp,
+    CONST ub4    type
+);
+
+sword OCI_DescriptorAllocCached
+(
+    CONST dvoid *parenth,
+    dvoid      **descpp,
+    CONST ub4    type
+);
+
+sword OCI_DescriptorFreeCached
+(
+    CONST dvoid *parenth,
+    dvoid       *descp,
+    CONST ub4    type
+);
+
 sword OCI_ObjectNew
 (
     OCIEnv          *env,
@@ -944,6 +1119,74 @@ OCI_Mutex * OCI_MutexCreateInternal
  * number.c
  * --------------------------------------------------------------------------------------------- */
 
+boolean OCI_NumberUnpack
+(
+    OCINumber *number,
+    boolean   *neg,
+    int       *exp,
+    ub1       *digits,
+    int       *count
+);
+
+boolean OCI_NumberPack
+(
+    OCINumber *number,
+    boolean    neg,
+    int        exp,
+    ub1       *digits,
+    int        count
+);
+
+boolean OCI_NumberDecodeInt
+(
+    OCINumber *number,
+    uword      size,
+    uword      sign,
+    void      *out_value
+);
+
+boolean OCI_NumberEncodeInt
+(
+    OCINumber *number,
+    uword      size,
+    uword      sign,
+    void      *in_value
+);
+
+boolean OCI_NumberDecodeReal
+(
+    OCINumber *number,
+    double    *out_value
+);
+
+boolean OCI_NumberEncodeReal
+(
+    OCINumber *number,
+    double     in_value
+);
+
+boolean OCI_NumberDecodeText
+(
+    OCINumber *number,
+    otext     *out_value,
+    int       *out_value_size
+);
+
+boolean OCI_NumberEncodeText
+(
+    OCINumber   *number,
+    const otext *in_value
+);
+
+boolean OCI_NumberGetNative
+(
+    OCI_Connection *con,
+    void           *number,
+    uword           type,
+    int             sqlcode,
+    void           *out_value
+);
+
 boolean OCI_NumberGet
 (
     OCI_Connection *con,
@@ -1032,7 +1275,8 @@ OCI_Object * OCI_ObjectInit
 
 void OCI_ObjectReset
 (
-    OCI_Object *obj
+    OCI_Object *obj,
+    boolean     recycle
 );
 
 int OCI_ObjectGetAttrIndex
@@ -1076,6 +1320,12 @@ boolean OCI_PoolClose
     OCI_Pool *pool
 );
 
+void OCI_PoolPartitionProc
+(
+    OCI_Thread *thread,
+    void       *arg
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * ref.c
  * --------------------------------------------------------------------------------------------- */
@@ -1113,6 +1363,19 @@ boolean OCI_ResultsetInit
     OCI_Resultset *rs
 );
 
+OCI_Resultset * OCI_ResultsetReuse
+(
+    OCI_Statement *stmt
+);
+boolean OCI_ResultsetPackRows
+(
+    OCI_Resultset *rs,
+    ub4            slot_rows,
+    ub4           *counts,
+    ub4            nb_slots
+);
+
+
 boolean OCI_ResultsetFree
 (
     OCI_Resultset *rs
@@ -1123,6 +1386,74 @@ boolean OCI_FetchPieces
     OCI_Resultset *rs
 );
 
+boolean OCI_ResultsetSwapBuffers
+(
+    OCI_Resultset *rs
+);
+
+void OCI_FetchBackgroundProc
+(
+    OCI_Thread *thread,
+    void       *arg
+);
+
+boolean OCI_FetchBackgroundInit
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchBackgroundStart
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchBackgroundWait
+(
+    OCI_Resultset *rs,
+    boolean        discard
+);
+
+boolean OCI_FetchBackgroundFree
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchWindowInit
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchWindowReset
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchWindowFree
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_FetchWindowStore
+(
+    OCI_Resultset *rs,
+    ub4            first,
+    ub4            count
+);
+
+boolean OCI_FetchWindowLoad
+(
+    OCI_Resultset   *rs,
+    OCI_WindowEntry *entry
+);
+
+boolean OCI_FetchWindow
+(
+    OCI_Resultset *rs,
+    int            row,
+    boolean        backward,
+    boolean       *err
+);
+
 boolean OCI_FetchData
 (
     OCI_Resultset *rs,
@@ -1139,11 +1470,23 @@ boolean OCI_FetchCustom
     boolean       *err
 );
 
-boolean OCI_ResultsetExpandStrings
+boolean OCI_ResultsetResetStrings
+(
+    OCI_Resultset *rs
+);
+
+boolean OCI_ResultsetCompileLayout
 (
     OCI_Resultset *rs
 );
 
+boolean OCI_ResultsetFillStruct
+(
+    OCI_Resultset *rs,
+    void          *row_struct,
+    void          *row_struct_ind
+);
+
 boolean OCI_ClearFetchedObjectInstances
 (
     OCI_Resultset *rs
@@ -1188,6 +1531,35 @@ int OCI_BindGetInternalIndex
     const otext   *name
 );
 
+ub4 OCI_PlaceholderScan
+(
+    const otext     *sql,
+    OCI_Placeholder *phs
+);
+
+ub4 OCI_PlaceholderHash
+(
+    const otext *name,
+    ub4          length
+);
+
+int OCI_PlaceholderCompare
+(
+    const void *ph1,
+    const void *ph2
+);
+
+boolean OCI_PlaceholderIndex
+(
+    OCI_Statement *stmt
+);
+
+OCI_Placeholder * OCI_PlaceholderFind
+(
+    OCI_Statement *stmt,
+    const otext   *name
+);
+
 boolean OCI_FetchIntoUserVariables
 (
     OCI_Statement *stmt,
@@ -1228,6 +1600,13 @@ boolean OCI_BatchErrorInit
     OCI_Statement *stmt
 );
 
+boolean OCI_BatchErrorMerge
+(
+    OCI_Statement    *stmt,
+    OCI_BatchErrors **batch,
+    ub4               offset
+);
+
 boolean OCI_API OCI_PrepareInternal
 (
     OCI_Statement *stmt,
@@ -1388,6 +1767,11 @@ void OCI_ThreadProc
     dvoid *arg
 );
 
+boolean OCI_ThreadClose
+(
+    OCI_Thread *thread
+);
+
 /* --------------------------------------------------------------------------------------------- *
  * threadkey.c
  * --------------------------------------------------------------------------------------------- */
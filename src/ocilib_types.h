@@ -55,8 +55,9 @@
 
 struct OCI_Item
 {
-    void            *data; /* pointer to external data */
+    void            *data; /* pointer to data, allocated right after the item */
     struct OCI_Item *next; /* next element in list */
+    struct OCI_Item *prev; /* previous element in list */
 };
 
 typedef struct OCI_Item OCI_Item;
@@ -76,6 +77,7 @@ typedef struct OCI_Item OCI_Item;
 struct OCI_List
 {
     OCI_Item  *head;     /* pointer to first item */
+    OCI_Item  *tail;     /* pointer to last item */
     OCI_Mutex *mutex;    /* mutex handle */
     ub4        count;    /* number of elements in list */
     int        type;     /* type of list item */
@@ -83,6 +85,74 @@ struct OCI_List
 
 typedef struct OCI_List OCI_List;
 
+/*
+ * OCI_MemHeader : prefix of memory blocks when memory statistics are enabled
+ *
+ */
+
+struct OCI_MemHeader
+{
+    size_t size;                    /* requested size of the block */
+    int    type;                    /* OCI_IPC_XXX type of the block */
+};
+
+typedef struct OCI_MemHeader OCI_MemHeader;
+
+/*
+ * OCI_MemStats : memory statistics of a given type of memory blocks
+ *
+ */
+
+struct OCI_MemStats
+{
+    big_uint     cur_bytes;         /* bytes currently allocated */
+    big_uint     max_bytes;         /* high-water mark of allocated bytes */
+    big_uint     nb_allocs;         /* number of allocations */
+    unsigned int cur_blocks;        /* number of blocks currently allocated */
+};
+
+typedef struct OCI_MemStats OCI_MemStats;
+
+/*
+ * OCI_Arena : Internal bump allocator.
+ *
+ * Objects that live until the owner is reset are carved out of large chunks
+ * instead of being allocated one by one. They are never freed individually.
+ *
+ */
+
+struct OCI_ArenaChunk
+{
+    struct OCI_ArenaChunk *next;    /* previous chunk */
+    size_t                 size;    /* usable size of the chunk */
+    size_t                 used;    /* number of bytes already handed out */
+};
+
+typedef struct OCI_ArenaChunk OCI_ArenaChunk;
+
+struct OCI_Arena
+{
+    OCI_ArenaChunk *head;           /* current chunk */
+};
+
+typedef struct OCI_Arena OCI_Arena;
+
+/*
+ * OCI_HandleCache : Recycling pool of OCI handles or descriptors of a given type.
+ *
+ * Released handles are kept for reuse instead of being handed back to the
+ * OCI client, up to a configurable number of idle handles per type.
+ *
+ */
+
+struct OCI_HandleCache
+{
+    void **items;                   /* idle handles ready for reuse */
+    ub4    count;                   /* number of idle handles */
+};
+
+typedef struct OCI_HandleCache OCI_HandleCache;
+
 /*
  * Server output object used to retrieve server dbms.output buffers
  *
@@ -162,8 +232,30 @@ struct OCI_Thread
     OCIError        *err;       /* OCI Error handle */
     void            *arg;       /* thread routine argument */
     POCI_THREAD      proc;      /* thread routine */
+    boolean          opened;    /* is the handle opened by OCIThreadCreate() ? */
 };
 
+/*
+ * Partition worker : thread fetching one partition of a parallel query
+ *
+ */
+
+struct OCI_PartitionWorker
+{
+    OCI_Pool            *pool;      /* pool providing the worker connection */
+    OCI_Thread          *thread;    /* worker thread */
+    const otext         *sql;       /* partitioned query */
+    POCI_PARTITION_FETCH proc;      /* user row callback */
+    void                *arg;       /* user callback argument */
+    unsigned int         index;     /* partition index */
+    unsigned int         rows;      /* number of rows fetched */
+    boolean              running;   /* has the thread been started ? */
+    boolean              status;    /* worker execution status */
+    OCI_Error            err;       /* copy of the worker error */
+};
+
+typedef struct OCI_PartitionWorker OCI_PartitionWorker;
+
 /*
  * Thread key object
  *
@@ -217,6 +309,10 @@ struct OCI_Library
     OCI_HashTable       *sql_funcs;               /* hash table handle for sql function names */
     POCI_HA_HANDLER      ha_handler;              /* HA event callback*/
     otext               *formats[OCI_FMT_COUNT];  /* string conversion default formats */
+    OCI_HandleCache      hdl_caches[OCI_HDL_CACHE_COUNT]; /* recycling pools of OCI handles */
+    unsigned int         hdl_cache_size;          /* max number of idle handles per type */
+    OCI_Mutex           *hdl_cache_mutex;         /* recycling pools lock */
+    OCI_Mutex           *mem_mutex;               /* memory statistics lock */
 #ifdef OCI_IMPORT_RUNTIME
     LIB_HANDLE           lib_handle;              /* handle of runtime shared library */
 #endif
@@ -246,6 +342,52 @@ struct OCI_Pool
     ub4          cache_size;    /* statement cache size */
 };
 
+/*
+ * Statement object cache entry
+ *
+ */
+
+struct OCI_StatementCacheEntry
+{
+    OCI_Statement *stmt;    /* cached prepared statement */
+    unsigned int   hash;    /* hash code of the SQL text */
+    big_uint       stamp;   /* last use stamp for LRU eviction */
+};
+
+typedef struct OCI_StatementCacheEntry OCI_StatementCacheEntry;
+
+/*
+ * Statement object cache
+ *
+ */
+
+struct OCI_StatementCache
+{
+    OCI_StatementCacheEntry *entries;   /* array of cache entries */
+    unsigned int             size;      /* maximum number of cached statements */
+    unsigned int             count;     /* current number of cached statements */
+    unsigned int             hits;      /* number of lookups found in the cache */
+    unsigned int             misses;    /* number of lookups not found in the cache */
+    big_uint                 stamp;     /* LRU clock */
+};
+
+typedef struct OCI_StatementCache OCI_StatementCache;
+
+/*
+ * Placeholder found in the SQL text at prepare time
+ *
+ */
+
+struct OCI_Placeholder
+{
+    ub4 offset;     /* offset of the name (without leading ':') in the SQL text */
+    ub4 length;     /* length of the name */
+    int index;      /* internal bind index (user binds > 0, register binds < 0, 0 if not bound) */
+    ub4 hash;       /* case insensitive hash of the name */
+};
+
+typedef struct OCI_Placeholder OCI_Placeholder;
+
 /*
  * Connection object
  *
@@ -285,6 +427,10 @@ struct OCI_Connection
     otext            *domain_name;  /* server domain name */
     OCI_Timestamp    *inst_startup; /* instance startup timestamp */
     otext            *formats[OCI_FMT_COUNT];  /* string conversion default formats */
+    OCI_StatementCache scache;      /* statement object cache */
+    boolean           fmt_bind;     /* formatted functions bind their values ? */
+    boolean           nb_mode;      /* server handle in non blocking mode ? */
+    boolean           nb_call;      /* non blocking call in progress ? */
 };
 
 /*
@@ -375,7 +521,9 @@ struct OCI_Bind
     ub1             alloc;       /* is buffer allocated or mapped to input */
     ub1             csfrm;       /* charset form */
     ub1             direction;   /* in, out or in/out bind */
-    char            padding[3];  /* dummy variable for alignment */ 
+    ub1             plan;        /* work to perform at execute time */
+    ub1             dirty;       /* have lengths been modified since last execute ? */
+    char            padding[1];  /* dummy variable for alignment */ 
 }
 ;
 
@@ -386,14 +534,44 @@ struct OCI_Bind
 
 struct OCI_Define
 {
-    OCI_Resultset  *rs;   /* pointer to resultset object */
-    void           *obj;  /* current OCILIB object instance */
-    OCI_Column      col;  /* column object */
-    OCI_Buffer      buf;  /* placeholder */
+    OCI_Resultset  *rs;      /* pointer to resultset object */
+    void           *obj;     /* current OCILIB object instance */
+    OCI_Column      col;     /* column object */
+    OCI_Buffer      buf;     /* placeholder */
+    OCI_Buffer      altbuf;  /* alternate placeholder for background fetching */
+    ub1            *expanded;/* bitmap of the rows whose string is already in UTF-32 */
 };
 
 typedef struct OCI_Define OCI_Define;
 
+/*
+ * OCI_FieldLayout : Internal layout of a resultset column in a user row structure
+ *
+ */
+
+struct OCI_FieldLayout
+{
+    size_t offset;   /* offset of the member in the structure */
+    size_t size;     /* size of the member including padding */
+};
+
+typedef struct OCI_FieldLayout OCI_FieldLayout;
+
+/*
+ * OCI_WindowEntry : batch of rows kept in the fetch window of a scrollable resultset
+ *
+ */
+
+struct OCI_WindowEntry
+{
+    ub4    first;    /* absolute position of the first row of the batch */
+    ub4    count;    /* number of rows of the batch (0 for a free entry) */
+    ub4    stamp;    /* last access stamp for LRU replacement */
+    void  *data;     /* copy of the define buffers, indicators and lengths */
+};
+
+typedef struct OCI_WindowEntry OCI_WindowEntry;
+
 /*
  * Resultset object
  *
@@ -413,6 +591,16 @@ struct OCI_Resultset
     boolean        bof;             /* beginning of resultset reached ?  */
     ub4            fetch_size;      /* internal array size */
     sword          fetch_status;    /* internal fetch status */
+    OCI_Thread    *bg_thread;       /* background fetching thread */
+    OCIError      *bg_err;          /* error handle used by background fetching */
+    sword          bg_status;       /* background fetch status */
+    boolean        bg_pending;      /* background fetch in progress ? */
+    OCI_FieldLayout *layout;        /* user row structure layout */
+    size_t         row_size;        /* user row structure size */
+    OCI_WindowEntry *win_entries;   /* fetch window of scrollable resultsets */
+    ub4            win_size;        /* number of batches kept in the fetch window */
+    ub4            win_stamp;       /* fetch window access counter */
+    ub4            win_last;        /* absolute position of the last row if known */
 };
 
 /*
@@ -456,6 +644,7 @@ struct OCI_Statement
     ub4              prefetch_mem;      /* pre-fetch memory */
     ub4              long_size;         /* default size for LONG columns */
     ub1              long_mode;         /* LONG datatype handling mode */
+    ub4              lob_size;          /* maximum size for LOBs fetched as data */
     ub1              status;            /* statement status */
     ub2              type;              /* type of SQL statement */
     ub4              nb_iters;          /* current number of iterations for execution */
@@ -465,9 +654,23 @@ struct OCI_Statement
     ub2              cur_rs;            /* index of the current resultset */
     ub2              dynidx;            /* bind index counter for dynamic exec */
     boolean          bind_array;        /* has array binds ? */
+    boolean          bg_fetch;          /* background fetching enabled ? */
+    ub4              win_size;          /* fetch window size for scrollable resultsets */
     OCI_BatchErrors *batch;             /* error handling for array DML */
     ub2              err_pos;           /* error position in sql statement */
-    char             padding[2];        /* dummy variable for alignment */ 
+    ub1              num_mode;          /* NUMBER columns define mode */
+    ub1              lob_mode;          /* LOB columns define mode */
+    boolean          rs_reuse;          /* keep the resultset across prepares ? */
+    OCI_Resultset   *rs_spare;          /* resultset kept for reuse by the next execution */
+    boolean          chunked;           /* last execution was a chunked array DML ? */
+    ub4              chunk_rows;        /* affected rows of the last chunked execution */
+    boolean          exec_pending;      /* non blocking execution not completed yet ? */
+    OCI_Placeholder *phs;               /* placeholders of the SQL text */
+    ub4              nb_phs;            /* number of placeholders */
+    OCI_Placeholder **phs_index;        /* placeholders sorted by name hash */
+    ub4              ret_rows;          /* expected returned rows per iteration (preallocated mode) */
+    ub4             *ret_counts;        /* rows returned by each iteration (preallocated mode) */
+    OCI_Arena        arena;             /* allocator of objects living until the next prepare */
 };
 
 /*
@@ -859,6 +1062,34 @@ struct OCI_Array
 
 typedef struct OCI_Array OCI_Array;
 
+/*
+ * Hash table slot : precomputed hash of the key and its entry
+ *
+ */
+
+struct OCI_HashSlot
+{
+    unsigned int    hash;         /* hash of the key */
+    OCI_HashEntry  *entry;        /* entry or NULL if the slot is empty */
+};
+
+typedef struct OCI_HashSlot OCI_HashSlot;
+
+/*
+ * Hash table node : an entry, its first value and its key allocated in one block
+ *
+ */
+
+struct OCI_HashNode
+{
+    OCI_HashEntry   entry;        /* public entry, must be the first member */
+    OCI_HashValue   value;        /* storage of the first value */
+    OCI_HashValue  *last;         /* last value for appending */
+    otext           key[1];       /* key string */
+};
+
+typedef struct OCI_HashNode OCI_HashNode;
+
 /*
  * Hash table object
  *
@@ -866,8 +1097,8 @@ typedef struct OCI_Array OCI_Array;
 
 struct OCI_HashTable
 {
-    OCI_HashEntry **items;        /* array of slots */
-    unsigned int    size;         /* size of the slots array */
+    OCI_HashSlot   *items;        /* array of slots (open addressing) */
+    unsigned int    size;         /* size of the slots array (power of 2) */
     unsigned int    count;        /* number of used slots */
     unsigned int    type;         /* type of data */
 };
@@ -127,6 +127,89 @@ boolean OCI_PoolClose
     return res;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_PoolPartitionProc
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_PoolPartitionProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_PartitionWorker *wrk  = (OCI_PartitionWorker *) arg;
+    OCI_Connection      *con  = NULL;
+    OCI_Statement       *stmt = NULL;
+    OCI_Resultset       *rs   = NULL;
+    OCI_Error           *err  = NULL;
+    boolean              stop = FALSE;
+
+    OCI_NOT_USED(thread)
+
+    /* each partition is fetched from its own connection */
+
+    con = OCI_PoolGetConnection(wrk->pool, NULL);
+
+    wrk->status = (NULL != con);
+
+    if (wrk->status)
+    {
+        stmt = OCI_StatementCreate(con);
+
+        wrk->status = (NULL != stmt);
+    }
+
+    if (wrk->status)
+    {
+        wrk->status = OCI_Prepare(stmt, wrk->sql) &&
+                      OCI_BindUnsignedInt(stmt, OTEXT(":ocilib_part"), &wrk->index) &&
+                      OCI_Execute(stmt);
+    }
+
+    if (wrk->status)
+    {
+        rs = OCI_GetResultset(stmt);
+
+        wrk->status = (NULL != rs);
+    }
+
+    while (wrk->status && !stop && OCI_FetchNext(rs))
+    {
+        wrk->rows++;
+
+        stop = !wrk->proc(rs, wrk->index, wrk->arg);
+    }
+
+    /* a fetch that did not reach the end of the resultset has failed */
+
+    if (wrk->status && !stop && !rs->eof)
+    {
+        wrk->status = FALSE;
+    }
+
+    /* keep a copy of the error before it gets reset by the next calls */
+
+    if (!wrk->status)
+    {
+        err = OCI_GetLastError();
+
+        if (err)
+        {
+            wrk->err = *err;
+        }
+    }
+
+    if (stmt)
+    {
+        OCI_StatementFree(stmt);
+    }
+
+    if (con)
+    {
+        OCI_ConnectionFree(con);
+    }
+}
+
 /* ********************************************************************************************* *
  *                             PUBLIC FUNCTIONS
  * ********************************************************************************************* */
@@ -404,8 +487,6 @@ boolean OCI_API OCI_PoolFree
 
     OCI_ListRemove(OCILib.pools, pool);
 
-    OCI_FREE(pool)
-
     call_retval = call_status;
 
     OCI_LIB_CALL_EXIT()
@@ -934,3 +1015,112 @@ unsigned int OCI_API OCI_PoolGetStatementCacheSize
     OCI_LIB_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_PoolExecuteParallel
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_PoolExecuteParallel
+(
+    OCI_Pool            *pool,
+    const otext         *sql,
+    const otext         *key,
+    unsigned int         nb_parts,
+    POCI_PARTITION_FETCH proc,
+    void                *arg
+)
+{
+    OCI_PartitionWorker *wrks  = NULL;
+    otext               *query = NULL;
+    otext                buffer[OCI_SIZE_BUFFER+1];
+    size_t               size  = 0;
+    unsigned int         i     = 0;
+
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_THREAD_ENABLED()
+    OCI_CHECK_PTR(OCI_IPC_POOL, pool)
+    OCI_CHECK_PTR(OCI_IPC_STRING, sql)
+    OCI_CHECK_PTR(OCI_IPC_STRING, key)
+    OCI_CHECK_PTR(OCI_IPC_PROC, proc)
+    OCI_CHECK_MIN(NULL, NULL, nb_parts, 1)
+
+    /* build the partitioned query : the same SQL text is used by all partitions
+       in order to be shared in the server and statement caches */
+
+    osprintf(buffer, OCI_SIZE_BUFFER, OTEXT("%u"), nb_parts - 1);
+
+    size = ostrlen(sql) + ostrlen(key) + ostrlen(buffer) + (size_t) OCI_SIZE_BUFFER;
+
+    query = (otext *) OCI_MemAlloc(OCI_IPC_STRING, sizeof(otext), size + 1, TRUE);
+    wrks  = (OCI_PartitionWorker *) OCI_MemAlloc(OCI_IPC_PARTITION_ARRAY, sizeof(*wrks),
+                                                 (size_t) nb_parts, TRUE);
+
+    call_status = (query && wrks);
+
+    if (call_status)
+    {
+        ostrncat(query, OTEXT("SELECT * FROM ("), size);
+        ostrncat(query, sql, size - ostrlen(query));
+        ostrncat(query, OTEXT(") WHERE ORA_HASH("), size - ostrlen(query));
+        ostrncat(query, key, size - ostrlen(query));
+        ostrncat(query, OTEXT(", "), size - ostrlen(query));
+        ostrncat(query, buffer, size - ostrlen(query));
+        ostrncat(query, OTEXT(") = :ocilib_part"), size - ostrlen(query));
+    }
+
+    /* start one worker thread per partition */
+
+    for (i = 0; call_status && (i < nb_parts); i++)
+    {
+        wrks[i].pool   = pool;
+        wrks[i].sql    = query;
+        wrks[i].proc   = proc;
+        wrks[i].arg    = arg;
+        wrks[i].index  = i;
+        wrks[i].thread = OCI_ThreadCreate();
+
+        call_status = (NULL != wrks[i].thread);
+
+        if (call_status)
+        {
+            wrks[i].running = OCI_ThreadRun(wrks[i].thread, OCI_PoolPartitionProc, &wrks[i]);
+
+            call_status = wrks[i].running;
+        }
+    }
+
+    /* wait for all started workers, even if some of them could not be started */
+
+    for (i = 0; wrks && (i < nb_parts); i++)
+    {
+        if (wrks[i].running)
+        {
+            OCI_ThreadJoin(wrks[i].thread);
+
+            /* report the first partition error to the calling thread */
+
+            if (call_status && !wrks[i].status)
+            {
+                call_status = FALSE;
+
+                if (OCI_LIB_CONTEXT && (OCI_UNKNOWN != wrks[i].err.type))
+                {
+                    OCI_ExceptionForward(&wrks[i].err);
+                }
+            }
+        }
+
+        if (wrks[i].thread)
+        {
+            OCI_ThreadFree(wrks[i].thread);
+        }
+    }
+
+    OCI_FREE(wrks)
+    OCI_FREE(query)
+
+    call_retval = call_status;
+
+    OCI_LIB_CALL_EXIT()
+}
+
@@ -202,6 +202,20 @@ OCI_Resultset * OCI_ResultsetCreate
 
                     res = OCI_DefineAlloc(def) && OCI_DefineDef(def, i + 1);
                 }
+
+                /* setup background fetching if requested and possible */
+
+                if (res && rs->stmt->bg_fetch)
+                {
+                    OCI_FetchBackgroundInit(rs);
+                }
+
+                /* setup the fetch window of scrollable resultsets if requested */
+
+                if (res && (rs->stmt->win_size > 0))
+                {
+                    OCI_FetchWindowInit(rs);
+                }
             }
         }
         else
@@ -505,6 +519,288 @@ boolean OCI_FetchPieces
     return res;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ResultsetSwapBuffers
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ResultsetSwapBuffers
+(
+    OCI_Resultset *rs
+)
+{
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        void **data = def->buf.data;
+        void  *inds = def->buf.inds;
+        void  *lens = def->buf.lens;
+
+        def->buf.data = def->altbuf.data;
+        def->buf.inds = def->altbuf.inds;
+        def->buf.lens = def->altbuf.lens;
+
+        def->altbuf.data = data;
+        def->altbuf.inds = inds;
+        def->altbuf.lens = lens;
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchBackgroundProc
+ * --------------------------------------------------------------------------------------------- */
+
+void OCI_FetchBackgroundProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_Resultset *rs = (OCI_Resultset *) arg;
+
+    OCI_NOT_USED(thread)
+
+    /* only the OCI fetch call is performed here, with a dedicated error handle.
+       Post processing is done by OCI_FetchData() in the application thread */
+
+ #if defined(OCI_STMT_SCROLLABLE_READONLY)
+
+    if (OCILib.use_scrollable_cursors)
+    {
+        rs->bg_status = OCIStmtFetch2(rs->stmt->stmt, rs->bg_err, rs->fetch_size,
+                                      (ub2) OCI_SFD_NEXT, (sb4) 0, (ub4) OCI_DEFAULT);
+    }
+    else
+
+#endif
+
+    {
+        rs->bg_status = OCIStmtFetch(rs->stmt->stmt, rs->bg_err, rs->fetch_size,
+                                     (ub2) OCI_FETCH_NEXT, (ub4) OCI_DEFAULT);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchBackgroundInit
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchBackgroundInit
+(
+    OCI_Resultset *rs
+)
+{
+    boolean res = TRUE;
+    ub4 i, j;
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    /* background fetching is only performed for forward only resultsets of
+       select statements holding scalar columns */
+
+    OCI_CHECK(!OCI_LIB_THREADED, FALSE)
+    OCI_CHECK(rs->stmt->nb_rbinds > 0, FALSE)
+    OCI_CHECK(OCI_SFM_SCROLLABLE == rs->stmt->exec_mode, FALSE)
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        OCI_CHECK((OCI_CDT_NUMERIC  != def->col.datatype) &&
+                  (OCI_CDT_TEXT     != def->col.datatype) &&
+                  (OCI_CDT_RAW      != def->col.datatype) &&
+                  (OCI_CDT_DATETIME != def->col.datatype), FALSE)
+    }
+
+    /* allocate the worker thread and its error handle */
+
+    rs->bg_thread = OCI_ThreadCreate();
+
+    res = (NULL != rs->bg_thread);
+
+    if (res)
+    {
+        res = OCI_SUCCESSFUL(OCI_HandleAlloc((dvoid *) OCILib.env,
+                                             (dvoid **) (void *) &rs->bg_err,
+                                             (ub4) OCI_HTYPE_ERROR,
+                                             (size_t) 0, (dvoid **) NULL));
+    }
+
+    /* allocate alternate buffers */
+
+    for (i = 0; (i < rs->nb_defs) && res; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        def->altbuf.inds = (void *) OCI_MemAlloc(OCI_IPC_INDICATOR_ARRAY, sizeof(sb2),
+                                                 (size_t) def->buf.count, TRUE);
+
+        def->altbuf.lens = (void *) OCI_MemAlloc(OCI_IPC_LEN_ARRAY, (size_t) def->buf.sizelen,
+                                                 (size_t) def->buf.count, TRUE);
+
+        def->altbuf.data = (void **) OCI_MemAlloc(OCI_IPC_BUFF_ARRAY, (size_t) def->col.bufsize,
+                                                  (size_t) def->buf.count, TRUE);
+
+        res = (def->altbuf.inds && def->altbuf.lens && def->altbuf.data);
+
+        for (j = 0; (j < def->buf.count) && res; j++)
+        {
+            ((ub2 *) def->altbuf.lens)[j] = (ub2) def->col.bufsize;
+        }
+    }
+
+    if (!res)
+    {
+        OCI_FetchBackgroundFree(rs);
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchBackgroundStart
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchBackgroundStart
+(
+    OCI_Resultset *rs
+)
+{
+    boolean res = TRUE;
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+    OCI_CHECK(NULL == rs->bg_thread, FALSE)
+    OCI_CHECK(rs->bg_pending, FALSE)
+
+    /* register the alternate buffers to OCI while the current ones are kept
+       available to the application */
+
+    OCI_ResultsetSwapBuffers(rs);
+
+    for (i = 0; (i < rs->nb_defs) && res; i++)
+    {
+        res = OCI_DefineDef(&rs->defs[i], i + 1);
+    }
+
+    OCI_ResultsetSwapBuffers(rs);
+
+    if (res)
+    {
+        rs->bg_status = OCI_SUCCESS;
+
+        res = OCI_ThreadRun(rs->bg_thread, OCI_FetchBackgroundProc, rs);
+    }
+
+    rs->bg_pending = res;
+
+    /* on failure, register back the current buffers */
+
+    for (i = 0; (i < rs->nb_defs) && !res; i++)
+    {
+        OCI_DefineDef(&rs->defs[i], i + 1);
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchBackgroundWait
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchBackgroundWait
+(
+    OCI_Resultset *rs,
+    boolean        discard
+)
+{
+    boolean res = TRUE;
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    if (rs->bg_pending)
+    {
+        res = OCI_ThreadJoin(rs->bg_thread);
+
+        /* release the thread so that the handle can be reused by the next fetch */
+
+        OCI_ThreadClose(rs->bg_thread);
+
+        rs->bg_pending = FALSE;
+
+        if (discard)
+        {
+            /* rows fetched in background are dropped and current buffers are registered back */
+
+            for (i = 0; (i < rs->nb_defs) && res; i++)
+            {
+                res = OCI_DefineDef(&rs->defs[i], i + 1);
+            }
+        }
+        else
+        {
+            /* the alternate buffers become the current ones */
+
+            OCI_ResultsetSwapBuffers(rs);
+
+            rs->fetch_status = res ? rs->bg_status : OCI_ERROR;
+        }
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchBackgroundFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchBackgroundFree
+(
+    OCI_Resultset *rs
+)
+{
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    if (rs->bg_pending)
+    {
+        OCI_ThreadJoin(rs->bg_thread);
+        OCI_ThreadClose(rs->bg_thread);
+
+        rs->bg_pending = FALSE;
+    }
+
+    if (rs->bg_thread)
+    {
+        OCI_ThreadFree(rs->bg_thread);
+        rs->bg_thread = NULL;
+    }
+
+    if (rs->bg_err)
+    {
+        OCI_HandleFree((dvoid *) rs->bg_err, (ub4) OCI_HTYPE_ERROR);
+        rs->bg_err = NULL;
+    }
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        OCI_FREE(def->altbuf.data)
+        OCI_FREE(def->altbuf.inds)
+        OCI_FREE(def->altbuf.lens)
+    }
+
+    return TRUE;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_FetchData
  * --------------------------------------------------------------------------------------------- */
@@ -517,16 +813,41 @@ boolean OCI_FetchData
     boolean       *err
 )
 {
-    boolean res = TRUE;
+    boolean   res  = TRUE;
+    OCIError *errh = rs->stmt->con->err;
 
     /* let's initialize the error flag to TRUE until the process completes */
 
     *err = TRUE;
 
+    /* while the connection is in non blocking mode, only OCI_FetchNextAsync() can
+       fetch, blocking callers fail instead of silently not fetching */
+
+    if (rs->stmt->con->nb_mode && !rs->stmt->con->nb_call)
+    {
+        OCI_ExceptionAsyncPending(rs->stmt->con, rs->stmt);
+
+        return FALSE;
+    }
+
     OCI_ClearFetchedObjectInstances(rs);
 
     /* internal fetch */
 
+    if (rs->bg_pending)
+    {
+        /* rows have been fetched in background into the alternate buffers.
+           A join failure has already been raised with the thread error */
+
+        if (!OCI_FetchBackgroundWait(rs, FALSE))
+        {
+            return FALSE;
+        }
+
+        errh = rs->bg_err;
+    }
+    else
+
  #if defined(OCI_STMT_SCROLLABLE_READONLY)
 
     if (OCILib.use_scrollable_cursors)
@@ -545,16 +866,24 @@ boolean OCI_FetchData
                                         (ub4) OCI_DEFAULT);
     }
 
+    /* in non blocking mode, the fetch has to be repeated until it completes */
+
+    if (OCI_STILL_EXECUTING == rs->fetch_status)
+    {
+        *err = FALSE;
+
+        return FALSE;
+    }
 
     if (OCI_ERROR == rs->fetch_status)
     {
         /* failure */
-        OCI_ExceptionOCI(rs->stmt->con->err, rs->stmt->con, rs->stmt, FALSE);
+        OCI_ExceptionOCI(errh, rs->stmt->con, rs->stmt, FALSE);
         res = FALSE;
     }
     else if (OCI_SUCCESS_WITH_INFO == rs->fetch_status)
     {
-        OCI_ExceptionOCI(rs->stmt->con->err, rs->stmt->con, rs->stmt, TRUE);
+        OCI_ExceptionOCI(errh, rs->stmt->con, rs->stmt, TRUE);
         res = TRUE;
     }
     else if (OCI_NEED_DATA == rs->fetch_status)
@@ -563,11 +892,11 @@ boolean OCI_FetchData
         res = OCI_FetchPieces(rs);
     }
 
-    /* check string buffer for Unicode builds that need buffer expansion */
+    /* strings of Unicode builds that need buffer expansion are expanded on first access */
 
     if (OCILib.use_wide_char_conv)
     {
-        OCI_ResultsetExpandStrings(rs);
+        OCI_ResultsetResetStrings(rs);
     }
 
     /* check for success */
@@ -585,7 +914,7 @@ boolean OCI_FetchData
 
         if (OCI_SUCCESS_WITH_INFO == rs->fetch_status)
         {
-            OCI_ExceptionOCI(rs->stmt->con->err, rs->stmt->con, rs->stmt, TRUE);
+            OCI_ExceptionOCI(errh, rs->stmt->con, rs->stmt, TRUE);
         }
 
     #if defined(OCI_STMT_SCROLLABLE_READONLY)
@@ -651,6 +980,13 @@ boolean OCI_FetchData
         }
     }
 
+    /* while the application processes the current rows, fetch the next ones in background */
+
+    if (res && rs->bg_thread && (OCI_SUCCESS == rs->fetch_status))
+    {
+        OCI_FetchBackgroundStart(rs);
+    }
+
     return res;
 }
 
@@ -668,6 +1004,21 @@ boolean OCI_FetchCustom
 {
     boolean res = TRUE;
 
+    if (rs->win_entries)
+    {
+        /* the target row may be already in the fetch window */
+
+        int row = (OCI_SFD_ABSOLUTE == mode) ? offset : (int) rs->row_abs + offset;
+
+        if ((0 == offset) || ((OCI_SFD_RELATIVE == mode) && (((offset > 0) && rs->eof) ||
+                                                              ((offset < 0) && rs->bof))))
+        {
+            return FALSE;
+        }
+
+        return OCI_FetchWindow(rs, row, row < (int) rs->row_abs, err);
+    }
+
     switch (mode)
     {
         case OCI_SFD_RELATIVE:
@@ -730,60 +1081,544 @@ boolean OCI_FetchCustom
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * OCI_ResultsetExpandStrings
+ * OCI_FetchWindowInit
  * --------------------------------------------------------------------------------------------- */
 
-boolean OCI_ResultsetExpandStrings
+boolean OCI_FetchWindowInit
 (
     OCI_Resultset *rs
 )
 {
     ub4 i;
-    int j;
 
     OCI_CHECK(NULL == rs, FALSE)
 
+    /* the fetch window is only used for scrollable resultsets of select statements
+       holding scalar columns that can be saved by copying their buffers */
+
+    OCI_CHECK(OCI_SFM_SCROLLABLE != rs->stmt->exec_mode, FALSE)
+    OCI_CHECK(rs->stmt->nb_rbinds > 0, FALSE)
+
     for (i = 0; i < rs->nb_defs; i++)
     {
         OCI_Define *def = &rs->defs[i];
 
-        if (OCI_CDT_TEXT == def->col.datatype)
-        {
-            for (j = (int) (def->buf.count-1); j >= 0; j--)
-            {
-                ub1 * tmpbuf = ((ub1*) def->buf.data) + (def->col.bufsize * j);
+        OCI_CHECK((OCI_CDT_NUMERIC  != def->col.datatype) &&
+                  (OCI_CDT_TEXT     != def->col.datatype) &&
+                  (OCI_CDT_RAW      != def->col.datatype) &&
+                  (OCI_CDT_DATETIME != def->col.datatype), FALSE)
+    }
 
-                OCI_StringUTF16ToUTF32(tmpbuf, tmpbuf, (def->col.bufsize / sizeof(otext) ) -1);
-            }
-        }
+    /* batch buffers are allocated when the batches are stored */
+
+    rs->win_entries = (OCI_WindowEntry *) OCI_MemAlloc(OCI_IPC_FETCH_WINDOW, sizeof(*rs->win_entries),
+                                                       (size_t) rs->stmt->win_size, TRUE);
+
+    if (rs->win_entries)
+    {
+        rs->win_size = rs->stmt->win_size;
     }
 
-    return TRUE;
+    return (NULL != rs->win_entries);
 }
 
 /* --------------------------------------------------------------------------------------------- *
-* OCI_ResultsetInit
-* --------------------------------------------------------------------------------------------- */
+ * OCI_FetchWindowReset
+ * --------------------------------------------------------------------------------------------- */
 
-boolean OCI_ResultsetInit
+boolean OCI_FetchWindowReset
 (
-OCI_Resultset *rs
+    OCI_Resultset *rs
 )
 {
-    rs->bof          = TRUE;
-    rs->eof          = FALSE;
-    rs->fetch_status = OCI_SUCCESS;
-    rs->row_count    = 0;
-    rs->row_cur      = 0;
-    rs->row_abs      = 0;
-    rs->row_fetched  = 0;
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    for (i = 0; i < rs->win_size; i++)
+    {
+        rs->win_entries[i].first = 0;
+        rs->win_entries[i].count = 0;
+        rs->win_entries[i].stamp = 0;
+    }
+
+    rs->win_stamp = 0;
+    rs->win_last  = 0;
 
     return TRUE;
 }
 
-
 /* --------------------------------------------------------------------------------------------- *
-* OCI_ResultsetFree
+ * OCI_FetchWindowFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchWindowFree
+(
+    OCI_Resultset *rs
+)
+{
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    for (i = 0; i < rs->win_size; i++)
+    {
+        OCI_FREE(rs->win_entries[i].data)
+    }
+
+    OCI_FREE(rs->win_entries)
+
+    rs->win_size = 0;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchWindowStore
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchWindowStore
+(
+    OCI_Resultset *rs,
+    ub4            first,
+    ub4            count
+)
+{
+    OCI_WindowEntry *entry = NULL;
+    ub1             *ptr   = NULL;
+    ub4              i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+    OCI_CHECK(NULL == rs->win_entries, FALSE)
+    OCI_CHECK(0 == count, FALSE)
+
+    /* use a free entry or replace the least recently used one */
+
+    for (i = 0; i < rs->win_size; i++)
+    {
+        OCI_WindowEntry *cur = &rs->win_entries[i];
+
+        if (0 == cur->count)
+        {
+            entry = cur;
+            break;
+        }
+
+        if (!entry || (cur->stamp < entry->stamp))
+        {
+            entry = cur;
+        }
+    }
+
+    if (!entry->data)
+    {
+        size_t size = 0;
+
+        for (i = 0; i < rs->nb_defs; i++)
+        {
+            OCI_Define *def = &rs->defs[i];
+
+            size += (size_t) def->buf.count * (def->col.bufsize + sizeof(sb2) + (size_t) def->buf.sizelen);
+        }
+
+        entry->data = OCI_MemAlloc(OCI_IPC_BUFF_ARRAY, size, (size_t) 1, FALSE);
+
+        OCI_CHECK(NULL == entry->data, FALSE)
+    }
+
+    /* save the buffers, indicators and lengths of each column */
+
+    ptr = (ub1 *) entry->data;
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        memcpy(ptr, def->buf.data, (size_t) def->col.bufsize * count);
+        ptr += (size_t) def->col.bufsize * def->buf.count;
+
+        memcpy(ptr, def->buf.inds, sizeof(sb2) * count);
+        ptr += sizeof(sb2) * def->buf.count;
+
+        memcpy(ptr, def->buf.lens, (size_t) def->buf.sizelen * count);
+        ptr += (size_t) def->buf.sizelen * def->buf.count;
+    }
+
+    entry->first = first;
+    entry->count = count;
+    entry->stamp = ++rs->win_stamp;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchWindowLoad
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchWindowLoad
+(
+    OCI_Resultset   *rs,
+    OCI_WindowEntry *entry
+)
+{
+    ub1 *ptr = NULL;
+    ub4  i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+    OCI_CHECK(NULL == entry, FALSE)
+
+    /* restore the buffers, indicators and lengths of each column */
+
+    ptr = (ub1 *) entry->data;
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        memcpy(def->buf.data, ptr, (size_t) def->col.bufsize * entry->count);
+        ptr += (size_t) def->col.bufsize * def->buf.count;
+
+        memcpy(def->buf.inds, ptr, sizeof(sb2) * entry->count);
+        ptr += sizeof(sb2) * def->buf.count;
+
+        memcpy(def->buf.lens, ptr, (size_t) def->buf.sizelen * entry->count);
+        ptr += (size_t) def->buf.sizelen * def->buf.count;
+    }
+
+    /* saved strings were not expanded yet */
+
+    if (OCILib.use_wide_char_conv)
+    {
+        OCI_ResultsetResetStrings(rs);
+    }
+
+    rs->row_fetched = entry->count;
+    entry->stamp    = ++rs->win_stamp;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchWindow
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_FetchWindow
+(
+    OCI_Resultset *rs,
+    int            row,
+    boolean        backward,
+    boolean       *err
+)
+{
+    OCI_WindowEntry *entry = NULL;
+    boolean          res   = TRUE;
+    ub4              first = 0;
+    ub4              i;
+
+    *err = FALSE;
+
+    /* requested row out of the resultset bounds */
+
+    if (row < 1)
+    {
+        rs->bof = TRUE;
+        return FALSE;
+    }
+
+    if ((rs->win_last > 0) && ((ub4) row > rs->win_last))
+    {
+        rs->eof = TRUE;
+        return FALSE;
+    }
+
+    /* is the row part of the current rows ? */
+
+    if (rs->row_cur > 0)
+    {
+        first = rs->row_abs - rs->row_cur + 1;
+    }
+
+    if ((0 == rs->row_cur) || ((ub4) row < first) || ((ub4) row >= first + rs->row_fetched))
+    {
+        /* is the row part of a batch kept in the window ? */
+
+        for (i = 0; (i < rs->win_size) && !entry; i++)
+        {
+            OCI_WindowEntry *cur = &rs->win_entries[i];
+
+            if ((cur->count > 0) && ((ub4) row >= cur->first) && ((ub4) row < cur->first + cur->count))
+            {
+                entry = cur;
+            }
+        }
+
+        if (entry)
+        {
+            first = entry->first;
+            res   = OCI_FetchWindowLoad(rs, entry);
+        }
+        else
+        {
+            /* fetch the batch starting at the row or, when moving backward,
+               the batch ending at the row */
+
+            first = (ub4) row;
+
+            if (backward)
+            {
+                first = ((ub4) row > rs->fetch_size) ? (ub4) row - rs->fetch_size + 1 : 1;
+            }
+
+            res = OCI_FetchData(rs, OCI_SFD_ABSOLUTE, (int) first, err);
+
+            if (res)
+            {
+                if (OCI_NO_DATA == rs->fetch_status)
+                {
+                    rs->win_last = first + rs->row_fetched - 1;
+                }
+
+                OCI_FetchWindowStore(rs, first, rs->row_fetched);
+
+                if ((ub4) row >= first + rs->row_fetched)
+                {
+                    /* the row is beyond the end, stay on the last one */
+
+                    rs->row_cur = rs->row_fetched;
+                    rs->row_abs = first + rs->row_fetched - 1;
+                    rs->eof     = TRUE;
+
+                    res = FALSE;
+                }
+            }
+        }
+    }
+
+    if (res)
+    {
+        rs->row_cur = (ub4) row - first + 1;
+        rs->row_abs = (ub4) row;
+        rs->bof     = FALSE;
+        rs->eof     = FALSE;
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ResultsetResetStrings
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ResultsetResetStrings
+(
+    OCI_Resultset *rs
+)
+{
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    /* newly fetched strings are not expanded yet */
+
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        if (def->expanded)
+        {
+            memset(def->expanded, 0, (size_t) ((def->buf.count + 7) / 8));
+        }
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+* OCI_ResultsetInit
+* --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ResultsetInit
+(
+OCI_Resultset *rs
+)
+{
+    /* drop any rows fetched in background by the previous execution */
+
+    OCI_FetchBackgroundWait(rs, TRUE);
+
+    /* rows kept in the fetch window belong to the previous execution */
+
+    OCI_FetchWindowReset(rs);
+
+    rs->bof          = TRUE;
+    rs->eof          = FALSE;
+    rs->fetch_status = OCI_SUCCESS;
+    rs->row_count    = 0;
+    rs->row_cur      = 0;
+    rs->row_abs      = 0;
+    rs->row_fetched  = 0;
+
+    return TRUE;
+}
+
+
+/* --------------------------------------------------------------------------------------------- *
+* OCI_ResultsetReuse
+* --------------------------------------------------------------------------------------------- */
+
+OCI_Resultset * OCI_ResultsetReuse
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_Resultset *rs  = stmt->rs_spare;
+    boolean        res = TRUE;
+    ub4            nb  = 0;
+    ub4            i;
+
+    stmt->rs_spare = NULL;
+
+    /* buffers are laid out for the fetch settings of the previous execution */
+
+    res = (rs->fetch_size == stmt->fetch_size) && (OCI_SFM_DEFAULT == stmt->exec_mode) &&
+          !stmt->bg_fetch && (0 == stmt->win_size);
+
+    OCI_CALL1
+    (
+        res, stmt->con, stmt,
+
+        OCIAttrGet((void *) stmt->stmt, (ub4) OCI_HTYPE_STMT,
+                   (void *) &nb, (ub4 *) NULL,
+                   (ub4) OCI_ATTR_PARAM_COUNT, stmt->con->err)
+    )
+
+    res = res && (nb == rs->nb_defs);
+
+    /* the select list must be described and mapped the same way */
+
+    for (i = 0; (i < nb) && res; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+        OCI_Column  col;
+
+        memset(&col, 0, sizeof(col));
+
+        res = OCI_ColumnDescribe(&col, stmt->con, stmt, stmt->stmt, i + 1, OCI_DESC_RESULTSET) &&
+              OCI_ColumnMap(&col, stmt);
+
+        res = res && (OCI_CDT_CURSOR != col.datatype) && (OCI_CDT_LONG != col.datatype) &&
+                     (col.sqlcode  == def->col.sqlcode)  && (col.libcode  == def->col.libcode)  &&
+                     (col.datatype == def->col.datatype) && (col.subtype  == def->col.subtype)  &&
+                     (col.size     == def->col.size)     && (col.bufsize  == def->col.bufsize)  &&
+                     (col.prec     == def->col.prec)     && (col.scale    == def->col.scale)    &&
+                     (col.csfrm    == def->col.csfrm)    && (col.typinf   == def->col.typinf)   &&
+                     col.name && def->col.name && (0 == ostrcmp(col.name, def->col.name));
+
+        OCI_FREE(col.name)
+    }
+
+    /* register the existing buffers to the new statement handle */
+
+    for (i = 0; (i < nb) && res; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        def->buf.handle = NULL;
+
+        res = OCI_DefineDef(def, i + 1);
+    }
+
+    res = res && OCI_ResultsetInit(rs);
+
+    if (!res)
+    {
+        OCI_ResultsetFree(rs);
+
+        rs = NULL;
+    }
+
+    return rs;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ResultsetPackRows
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ResultsetPackRows
+(
+    OCI_Resultset *rs,
+    ub4            slot_rows,
+    ub4           *counts,
+    ub4            nb_slots
+)
+{
+    ub4 i, j, k;
+    ub4 dst = 0;
+
+    OCI_CHECK(NULL == rs, FALSE)
+    OCI_CHECK(NULL == counts, FALSE)
+
+    /* the buffers hold fixed size slots of rows, partially filled : their rows are
+       moved one after the other at the beginning of the buffers */
+
+    for (i = 0; i < nb_slots; i++)
+    {
+        for (j = 0; j < counts[i]; j++, dst++)
+        {
+            ub4 src = i * slot_rows + j;
+
+            if (src == dst)
+            {
+                continue;
+            }
+
+            for (k = 0; k < rs->nb_defs; k++)
+            {
+                OCI_Define *def = &rs->defs[k];
+
+                switch (def->col.datatype)
+                {
+                    case OCI_CDT_CURSOR:
+                    case OCI_CDT_TIMESTAMP:
+                    case OCI_CDT_INTERVAL:
+                    case OCI_CDT_LOB:
+                    case OCI_CDT_FILE:
+                    {
+                        /* arrays of handles : handles are swapped to be kept allocated */
+
+                        void *hndl = def->buf.data[dst];
+
+                        def->buf.data[dst] = def->buf.data[src];
+                        def->buf.data[src] = hndl;
+                        break;
+                    }
+                    default:
+                    {
+                        memcpy(((ub1 *) def->buf.data) + (size_t) (def->col.bufsize * dst),
+                               ((ub1 *) def->buf.data) + (size_t) (def->col.bufsize * src),
+                               (size_t) def->col.bufsize);
+                        break;
+                    }
+                }
+
+                memcpy(((ub1 *) def->buf.lens) + (size_t) ((ub4) def->buf.sizelen * dst),
+                       ((ub1 *) def->buf.lens) + (size_t) ((ub4) def->buf.sizelen * src),
+                       (size_t) def->buf.sizelen);
+
+                memcpy(((ub1 *) def->buf.inds) + (size_t) ((ub4) sizeof(sb2) * dst),
+                       ((ub1 *) def->buf.inds) + (size_t) ((ub4) sizeof(sb2) * src),
+                       sizeof(sb2));
+            }
+        }
+    }
+
+    rs->row_count = dst;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+* OCI_ResultsetFree
 * --------------------------------------------------------------------------------------------- */
 
 boolean OCI_ResultsetFree
@@ -796,6 +1631,14 @@ OCI_Resultset *rs
 
     OCI_CHECK(NULL == rs, FALSE)
 
+    /* stop and release background fetching resources */
+
+    OCI_FetchBackgroundFree(rs);
+
+    /* release the fetch window */
+
+    OCI_FetchWindowFree(rs);
+
     for (i = 0; i < rs->nb_defs; i++)
     {
         OCI_Define *def = &(rs->defs[i]);
@@ -873,8 +1716,13 @@ OCI_Resultset *rs
         OCI_FREE(def->buf.obj_inds)
         OCI_FREE(def->buf.lens)
         OCI_FREE(def->buf.tmpbuf)
+        OCI_FREE(def->expanded)
     }
 
+    /* free structure layout */
+
+    OCI_FREE(rs->layout)
+
     /* free column map */
 
     if (rs->map)
@@ -922,6 +1770,176 @@ boolean OCI_ClearFetchedObjectInstances(OCI_Resultset *rs)
     return res;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ResultsetCompileLayout
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ResultsetCompileLayout
+(
+    OCI_Resultset *rs
+)
+{
+    size_t offset    = 0;
+    size_t max_align = 1;
+    size_t size1     = 0;
+    size_t size2     = 0;
+    size_t align1    = 0;
+    size_t align2    = 0;
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+
+    OCI_FREE(rs->layout)
+
+    rs->layout = (OCI_FieldLayout *) OCI_MemAlloc(OCI_IPC_FIELD_LAYOUT, sizeof(*rs->layout),
+                                                  (size_t) rs->nb_defs, TRUE);
+
+    OCI_CHECK(NULL == rs->layout, FALSE)
+
+    /* compute the offset and size of each user structure member once */
+
+    for (i = 1; i <= rs->nb_defs; i++)
+    {
+        OCI_Column *col1 = &rs->defs[i-1].col;
+        OCI_Column *col2 = &rs->defs[i  ].col;
+
+        OCI_ColumnGetAttrInfo(col1, rs->nb_defs, i-1, &size1, &align1);
+        OCI_ColumnGetAttrInfo(col2, rs->nb_defs, i  , &size2, &align2);
+
+        if (size2 > 0)
+        {
+            size1 = ROUNDUP(size1, align2);
+        }
+
+        if (align1 > max_align)
+        {
+            max_align = align1;
+        }
+
+        rs->layout[i-1].offset = offset;
+        rs->layout[i-1].size   = size1;
+
+        offset += size1;
+    }
+
+    /* size of the user structure including trailing padding for arrays of structures */
+
+    rs->row_size = ROUNDUP(offset, max_align);
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ResultsetFillStruct
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ResultsetFillStruct
+(
+    OCI_Resultset *rs,
+    void          *row_struct,
+    void          *row_struct_ind
+)
+{
+    boolean *inds = (boolean *) row_struct_ind;
+    ub4 i;
+
+    OCI_CHECK(NULL == rs, FALSE)
+    OCI_CHECK(NULL == rs->layout, FALSE)
+    OCI_CHECK(NULL == row_struct, FALSE)
+
+    for (i = 1; i <= rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i-1];
+        OCI_Column *col = &def->col;
+
+        char  *ptr  = ((char *) row_struct) + rs->layout[i-1].offset;
+        size_t size = rs->layout[i-1].size;
+
+        boolean is_not_null = OCI_DefineIsDataNotNull(def);
+
+        memset(ptr, 0, size);
+
+        if (is_not_null)
+        {
+            switch (col->datatype)
+            {
+                case OCI_CDT_NUMERIC:
+                {
+                    OCI_DefineGetNumber(rs, i, ptr, col->subtype, (uword) size);
+                    break;
+                }
+                case OCI_CDT_TEXT:
+                {
+                    *((otext **) ptr) =  (otext * ) OCI_GetString(rs, i);
+                    break;
+                }
+                case OCI_CDT_RAW:
+                {
+                    *((void **) ptr) = OCI_DefineGetData(def);
+                    break;
+                }
+                case OCI_CDT_LONG:
+                {
+                    *((OCI_Long **) ptr) = OCI_GetLong(rs, i);
+                    break;
+                }
+                case OCI_CDT_DATETIME:
+                {
+                    *((OCI_Date **) ptr) = OCI_GetDate(rs, i);
+                    break;
+                }
+                case OCI_CDT_CURSOR:
+                {
+                    *((OCI_Statement **) ptr) = OCI_GetStatement(rs, i);
+                    break;
+                }
+                case OCI_CDT_LOB:
+                {
+                    *((OCI_Lob **) ptr) = OCI_GetLob(rs, i);
+                    break;
+                }
+                case OCI_CDT_FILE:
+                {
+                    *((OCI_File **) ptr) = OCI_GetFile(rs, i);
+                    break;
+                }
+                case OCI_CDT_TIMESTAMP:
+                {
+                    *((OCI_Timestamp **) ptr) = OCI_GetTimestamp(rs, i);
+                    break;
+                }
+                case OCI_CDT_INTERVAL:
+                {
+                    *((OCI_Interval **) ptr) = OCI_GetInterval(rs, i);
+                    break;
+                }
+                case OCI_CDT_OBJECT:
+                {
+                    *((OCI_Object **) ptr) = OCI_GetObject(rs, i);
+                    break;
+                }
+                case OCI_CDT_COLLECTION:
+                {
+                    *((OCI_Coll **) ptr) = OCI_GetColl(rs, i);
+                    break;
+                }
+                case OCI_CDT_REF:
+                {
+                    *((OCI_Ref **) ptr) = OCI_GetRef(rs, i);
+                    break;
+                }
+            }
+        }
+
+        if (inds)
+        {
+            inds[i-1] = is_not_null;
+        }
+    }
+
+    return TRUE;
+}
+
 /* ********************************************************************************************* *
  *                            PUBLIC FUNCTIONS
  * ********************************************************************************************* */
@@ -972,7 +1990,19 @@ OCI_Resultset * OCI_API OCI_GetResultset
 
                 /* create resultset object */
 
-                call_retval = stmt->rsts[0] = OCI_ResultsetCreate(stmt, stmt->fetch_size);
+                /* reuse the resultset kept from a previous execution if possible */
+
+                if (stmt->rs_spare)
+                {
+                    call_retval = OCI_ResultsetReuse(stmt);
+                }
+
+                if (!call_retval)
+                {
+                    call_retval = OCI_ResultsetCreate(stmt, stmt->fetch_size);
+                }
+
+                stmt->rsts[0] = call_retval;
             }
 
         }
@@ -1032,7 +2062,13 @@ boolean OCI_API OCI_FetchPrev
     {
         call_retval = TRUE;
 
-        if (rs->row_cur == 1)
+        if (rs->win_entries)
+        {
+            /* previous rows may be already in the fetch window */
+
+            call_retval = OCI_FetchWindow(rs, (int) rs->row_abs - 1, TRUE, &call_status);
+        }
+        else if (rs->row_cur == 1)
         {
             if (rs->row_abs == 1)
             {
@@ -1110,7 +2146,13 @@ boolean OCI_API OCI_FetchNext
 
             if (rs->row_cur == rs->row_fetched)
             {
-                if (OCI_NO_DATA == rs->fetch_status)
+                if (rs->win_entries)
+                {
+                    /* next rows may be already in the fetch window */
+
+                    call_retval = OCI_FetchWindow(rs, (int) rs->row_abs + 1, FALSE, &call_status);
+                }
+                else if (OCI_NO_DATA == rs->fetch_status)
                 {
                     rs->eof = TRUE;
                 }
@@ -1137,16 +2179,6 @@ boolean OCI_API OCI_FetchNext
         {
             /* for resultset from returning into clause */
 
-            if (rs->row_abs == 0)
-            {
-                /* check string buffer once for Unicode build */
-
-                if (OCILib.use_wide_char_conv)
-                {
-                    OCI_ResultsetExpandStrings(rs);
-                }
-            }
-
             if (rs->row_abs >= rs->row_count)
             {
                 rs->eof = TRUE;
@@ -1158,9 +2190,69 @@ boolean OCI_API OCI_FetchNext
             }
         }
 
-        call_retval = call_retval && !rs->eof;
+        call_retval = call_retval && !rs->eof;
+    }
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchNextAsync
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_FetchNextAsync
+(
+    OCI_Resultset *rs
+)
+{
+    OCI_Connection *con = NULL;
+
+    OCI_LIB_CALL_ENTER(unsigned int, OCI_ASYNC_ERROR)
+
+    OCI_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+    OCI_CHECK_NON_BLOCKING_PENDING(rs->stmt->con, rs->stmt, OCI_STILL_EXECUTING == rs->fetch_status)
+
+    con = rs->stmt->con;
+
+    call_status = TRUE;
+
+    /* background fetching and fetch windows keep on performing blocking fetches */
+
+    if (!rs->bg_thread && !rs->win_entries)
+    {
+        call_status = OCI_ConnectionSetNonBlocking(con, TRUE);
+    }
+
+    con->nb_call = call_status;
+
+    if (call_status)
+    {
+        if (OCI_FetchNext(rs))
+        {
+            call_retval = OCI_ASYNC_DONE;
+        }
+        else if (OCI_STILL_EXECUTING == rs->fetch_status)
+        {
+            call_retval = OCI_ASYNC_PENDING;
+        }
+        else if (rs->eof)
+        {
+            call_retval = OCI_ASYNC_NO_MORE;
+        }
+    }
+
+    con->nb_call = FALSE;
+
+    /* restore blocking mode once the fetch has completed */
+
+    if (OCI_STILL_EXECUTING != rs->fetch_status)
+    {
+        OCI_ConnectionSetNonBlocking(con, FALSE);
     }
 
+    call_status = (OCI_ASYNC_ERROR != call_retval);
+
     OCI_LIB_CALL_EXIT()
 }
 
@@ -1185,13 +2277,23 @@ boolean OCI_API OCI_FetchFirst
 
     call_status = TRUE;
 
-    rs->bof = FALSE;
-    rs->eof = FALSE;
+    if (rs->win_entries)
+    {
+        rs->bof = FALSE;
+        rs->eof = FALSE;
+
+        call_retval = (OCI_FetchWindow(rs, 1, FALSE, &call_status) && !rs->bof);
+    }
+    else
+    {
+        rs->bof = FALSE;
+        rs->eof = FALSE;
 
-    rs->row_abs = 1;
-    rs->row_cur = 1;
+        rs->row_abs = 1;
+        rs->row_cur = 1;
 
-    call_retval = (OCI_FetchData(rs, OCI_SFD_FIRST, 0, &call_status) && !rs->bof);
+        call_retval = (OCI_FetchData(rs, OCI_SFD_FIRST, 0, &call_status) && !rs->bof);
+    }
 
 #endif
 
@@ -1222,12 +2324,28 @@ boolean OCI_API OCI_FetchLast
     rs->bof = FALSE;
     rs->eof = FALSE;
 
-    rs->row_abs = 0;
-    rs->row_cur = 1;
+    if (rs->win_entries && (rs->win_last > 0))
+    {
+        /* the last row position is known, it may be already in the fetch window */
+
+        call_retval = (OCI_FetchWindow(rs, (int) rs->win_last, TRUE, &call_status) && !rs->eof);
+    }
+    else
+    {
+        rs->row_abs = 0;
+        rs->row_cur = 1;
+
+        call_retval = (OCI_FetchData(rs, OCI_SFD_LAST, 0, &call_status) && !rs->eof);
+
+        rs->row_abs = rs->row_count;
 
-    call_retval = (OCI_FetchData(rs, OCI_SFD_LAST, 0, &call_status) && !rs->eof);
+        if (call_retval && rs->win_entries)
+        {
+            rs->win_last = rs->row_count;
 
-    rs->row_abs = rs->row_count;
+            OCI_FetchWindowStore(rs, rs->row_abs, 1);
+        }
+    }
 
 #endif
 
@@ -1270,6 +2388,185 @@ boolean OCI_API OCI_FetchSeek
     OCI_LIB_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_FetchBlock
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_FetchBlock
+(
+    OCI_Resultset *rs,
+    unsigned int  *nrows
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CHECK_PTR(OCI_IPC_INT, nrows)
+    OCI_CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+
+    call_status = TRUE;
+
+    *nrows = 0;
+
+    if (!rs->eof)
+    {
+        call_retval = TRUE;
+
+        if (rs->stmt->nb_rbinds == 0)
+        {
+            /* for regular resultsets, a block is always a new server round trip */
+
+            if (rs->win_entries)
+            {
+                /* the fetch window may have moved the server cursor, so the block following
+                   the current rows is fetched from its absolute position */
+
+                ub4 first = rs->row_abs - rs->row_cur + rs->row_fetched + 1;
+
+                if ((rs->win_last > 0) && (first > rs->win_last))
+                {
+                    rs->eof = TRUE;
+                }
+                else
+                {
+                    call_retval = OCI_FetchData(rs, OCI_SFD_ABSOLUTE, (int) first, &call_status);
+
+                    if (call_retval)
+                    {
+                        if (OCI_NO_DATA == rs->fetch_status)
+                        {
+                            rs->win_last = first + rs->row_fetched - 1;
+                        }
+
+                        OCI_FetchWindowStore(rs, first, rs->row_fetched);
+
+                        rs->bof     = FALSE;
+                        rs->row_cur = rs->row_fetched;
+                        rs->row_abs = first + rs->row_fetched - 1;
+
+                        *nrows = rs->row_fetched;
+                    }
+                }
+            }
+            else if ((OCI_NO_DATA == rs->fetch_status) && (rs->row_abs > 0))
+            {
+                rs->eof = TRUE;
+            }
+            else
+            {
+                /* rows of the current buffer not read yet with OCI_FetchNext() are skipped */
+
+                ub4 first = rs->row_abs - rs->row_cur + rs->row_fetched + 1;
+
+                call_retval = OCI_FetchData(rs, OCI_SFD_NEXT, 0, &call_status);
+
+                if (call_retval)
+                {
+                    rs->bof     = FALSE;
+                    rs->row_cur = rs->row_fetched;
+                    rs->row_abs = first + rs->row_fetched - 1;
+
+                    *nrows = rs->row_fetched;
+                }
+            }
+        }
+        else
+        {
+            /* for resultset from returning into clause, all rows are already available */
+
+            if (rs->row_abs >= rs->row_count)
+            {
+                rs->eof = TRUE;
+            }
+            else
+            {
+                *nrows = rs->row_count - rs->row_abs;
+
+                rs->bof     = FALSE;
+                rs->row_cur = rs->row_count;
+                rs->row_abs = rs->row_count;
+            }
+        }
+
+        call_retval = call_retval && !rs->eof;
+    }
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetColumnBlock
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_GetColumnBlock
+(
+    OCI_Resultset         *rs,
+    unsigned int           index,
+    const void           **data,
+    unsigned int          *size,
+    const short          **inds,
+    const void           **lens,
+    unsigned int          *lsize
+)
+{
+    OCI_Define *def = NULL;
+
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CHECK_BOUND(rs->stmt->con, index, 1, rs->nb_defs)
+
+    def = &rs->defs[index-1];
+
+    /* only scalar columns are stored contiguously in the define buffers */
+
+    OCI_CHECK_COMPAT(rs->stmt->con, (OCI_CDT_NUMERIC  == def->col.datatype) ||
+                                    (OCI_CDT_TEXT     == def->col.datatype) ||
+                                    (OCI_CDT_RAW      == def->col.datatype) ||
+                                    (OCI_CDT_DATETIME == def->col.datatype))
+
+    /* strings of the whole block are exposed at once */
+
+    if (def->expanded)
+    {
+        ub4 i;
+
+        for (i = 0; i < def->buf.count; i++)
+        {
+            OCI_DefineExpandString(def, i);
+        }
+    }
+
+    if (data)
+    {
+        *data = (const void *) def->buf.data;
+    }
+
+    if (size)
+    {
+        *size = (unsigned int) def->col.bufsize;
+    }
+
+    if (inds)
+    {
+        *inds = (const short *) def->buf.inds;
+    }
+
+    if (lens)
+    {
+        *lens = (const void *) def->buf.lens;
+    }
+
+    if (lsize)
+    {
+        *lsize = (unsigned int) def->buf.sizelen;
+    }
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_GetRowCount
  * --------------------------------------------------------------------------------------------- */
@@ -1424,6 +2721,10 @@ boolean OCI_API OCI_SetStructNumericType
 
     rs->defs[index-1].col.subtype = type;
 
+    /* structure layout needs to be computed again */
+
+    OCI_FREE(rs->layout)
+
     call_retval = call_status = TRUE;
 
     OCI_LIB_CALL_EXIT()
@@ -1468,9 +2769,6 @@ boolean OCI_API OCI_GetStruct
     void          *row_struct_ind
 )
 {
-    char *ptr     = NULL;
-    boolean *inds = NULL;
-
     OCI_LIB_CALL_ENTER(boolean, FALSE)
 
     OCI_CHECK_PTR(OCI_IPC_RESULTSET, rs)
@@ -1478,123 +2776,88 @@ boolean OCI_API OCI_GetStruct
 
     call_status = TRUE;
 
-    ptr  = (char    *) row_struct;
-    inds = (boolean *) row_struct_ind;
+    /* the structure layout is computed once and cached until numeric types are changed */
 
-    if (ptr)
+    if (!rs->layout)
     {
-        size_t size   = 0;
-        size_t size1  = 0;
-        size_t size2  = 0;
-        size_t align1 = 0;
-        size_t align2 = 0;
-        ub4 i;
+        call_status = OCI_ResultsetCompileLayout(rs);
+    }
 
-        for (i = 1; i <= rs->nb_defs; i++)
-        {
-            OCI_Column *col1 = &rs->defs[i-1].col;
-            OCI_Column *col2 = &rs->defs[i  ].col;
+    if (call_status)
+    {
+        call_status = OCI_ResultsetFillStruct(rs, row_struct, row_struct_ind);
+    }
 
-            boolean is_not_null = OCI_DefineIsDataNotNull(&rs->defs[i-1]);
+    call_retval = call_status;
 
-            OCI_ColumnGetAttrInfo(col1, rs->nb_defs, i-1, &size1, &align1);
-            OCI_ColumnGetAttrInfo(col2, rs->nb_defs, i  , &size2, &align2);
+    OCI_LIB_CALL_EXIT()
+}
 
-            if (size2 > 0)
-            {
-                size1 = ROUNDUP(size1, align2);
-            }
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetStructs
+ * --------------------------------------------------------------------------------------------- */
 
-            memset(ptr, 0, size1);
+unsigned int OCI_API OCI_GetStructs
+(
+    OCI_Resultset *rs,
+    void          *row_structs,
+    void          *row_structs_ind,
+    unsigned int   max_rows
+)
+{
+    unsigned int count = 0;
+    ub4 i;
 
-            if (is_not_null)
-            {
-                switch (col1->datatype)
-                {
-                    case OCI_CDT_NUMERIC:
-                    {
-                        OCI_DefineGetNumber(rs, i, ptr, col1->subtype, (uword) size1);
+    OCI_LIB_CALL_ENTER(unsigned int, 0)
 
-                        break;
-                    }
-                    case OCI_CDT_TEXT:
-                    {
-                        *((otext **) ptr) =  (otext * ) OCI_GetString(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_RAW:
-                    {
-                        *((void **) ptr) = OCI_DefineGetData(&rs->defs[i]);
-                        break;
-                    }
-                    case OCI_CDT_LONG:
-                    {
-                        *((OCI_Long **) ptr) = OCI_GetLong(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_DATETIME:
-                    {
-                        *((OCI_Date **) ptr) = OCI_GetDate(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_CURSOR:
-                    {
-                        *((OCI_Statement **) ptr) = OCI_GetStatement(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_LOB:
-                    {
-                        *((OCI_Lob **) ptr) = OCI_GetLob(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_FILE:
-                    {
-                        *((OCI_File **) ptr) = OCI_GetFile(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_TIMESTAMP:
-                    {
-                        *((OCI_Timestamp **) ptr) = OCI_GetTimestamp(rs, i);
+    OCI_CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    OCI_CHECK_PTR(OCI_IPC_VOID, row_structs)
+    OCI_CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
 
-                        break;
-                    }
-                    case OCI_CDT_INTERVAL:
-                    {
-                        *((OCI_Interval **) ptr) = OCI_GetInterval(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_OBJECT:
-                    {
-                        *((OCI_Object **) ptr) = OCI_GetObject(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_COLLECTION:
-                    {
-                        *((OCI_Coll **) ptr) = OCI_GetColl(rs, i);
-                        break;
-                    }
-                    case OCI_CDT_REF:
-                    {
-                        *((OCI_Ref **) ptr) = OCI_GetRef(rs, i);
-                        break;
-                    }
-                }
-            }
+    /* only members pointing to values or to the fetch buffers can be filled for several rows */
 
-            size += size1;
+    for (i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_CHECK_COMPAT(rs->stmt->con, (OCI_CDT_NUMERIC == rs->defs[i].col.datatype) ||
+                                        (OCI_CDT_TEXT    == rs->defs[i].col.datatype) ||
+                                        (OCI_CDT_RAW     == rs->defs[i].col.datatype))
+    }
 
-            ptr = ((char *) row_struct) + size;
+    call_status = TRUE;
 
-            if (inds)
-            {
-                *inds = is_not_null;
+    if (!rs->layout)
+    {
+        call_status = OCI_ResultsetCompileLayout(rs);
+    }
 
-                inds++;
-            }
+    while (call_status && (count < max_rows))
+    {
+        if ((rs->stmt->nb_rbinds == 0) && (rs->row_cur > 0) && (rs->row_cur < rs->row_fetched))
+        {
+            /* next row is already available in the current fetch batch */
+
+            rs->row_cur++;
+            rs->row_abs++;
+        }
+        else if ((count > 0) && (rs->stmt->nb_rbinds == 0))
+        {
+            /* stop at the end of the current fetch batch */
+
+            break;
+        }
+        else if (!OCI_FetchNext(rs))
+        {
+            break;
         }
+
+        call_status = OCI_ResultsetFillStruct(rs, ((char *) row_structs) + (count * rs->row_size),
+                                              row_structs_ind ? ((boolean *) row_structs_ind) +
+                                              (count * rs->nb_defs) : NULL);
+
+        count++;
     }
 
-    call_retval = call_status = TRUE;
+    call_retval = count;
 
     OCI_LIB_CALL_EXIT()
 }
@@ -1977,6 +3240,15 @@ unsigned int OCI_API OCI_GetRaw
 
         memcpy(buffer, OCI_DefineGetData(def), (size_t)call_retval);
     }
+    else if (OCI_MATCHING_TYPE(def, OCI_CDT_LOB) && (OCI_BLOB == def->col.subtype))
+    {
+        OCI_Lob *lob = OCI_GetLob(rs, index);
+
+        /* BLOBs are read through their locator that is rewound for further reads */
+
+        call_retval = OCI_LobRead(lob, buffer, len);
+        call_status = OCI_LobSeek(lob, 0, OCI_SEEK_SET);
+    }
 
     OCI_LIB_CALL_EXIT()
 }
@@ -2019,6 +3291,15 @@ unsigned int OCI_API OCI_GetRaw2
 
             memcpy(buffer, OCI_DefineGetData(def), (size_t)call_retval);
         }
+        else if (OCI_MATCHING_TYPE(def, OCI_CDT_LOB) && (OCI_BLOB == def->col.subtype))
+        {
+            OCI_Lob *lob = OCI_GetLob(rs, (unsigned int) index);
+
+            /* BLOBs are read through their locator that is rewound for further reads */
+
+            call_retval = OCI_LobRead(lob, buffer, len);
+            call_status = OCI_LobSeek(lob, 0, OCI_SEEK_SET);
+        }
     }
 
     OCI_LIB_CALL_EXIT()
@@ -2492,7 +3773,19 @@ unsigned int OCI_API OCI_GetDataLength
 
     if (def && (rs->row_cur > 0))
     {
-        call_retval = (unsigned int)((ub2 *)def->buf.lens)[rs->row_cur - 1];
+        if (OCI_CDT_LOB == def->col.datatype)
+        {
+            /* LOB length is given by the locator, not by the define buffer */
+
+            OCI_Lob *lob = OCI_GetLob(rs, index);
+
+            call_retval = lob ? (unsigned int) OCI_LobGetLength(lob) : 0;
+        }
+        else
+        {
+            call_retval = (unsigned int)((ub2 *)def->buf.lens)[rs->row_cur - 1];
+        }
+
         call_status = TRUE;
     }
 
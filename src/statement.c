@@ -50,11 +50,19 @@ static unsigned int FetchModeValues[]      = { OCI_SFM_DEFAULT, OCI_SFM_SCROLLAB
 static unsigned int BindModeValues[]       = { OCI_BIND_BY_POS, OCI_BIND_BY_NAME };
 static unsigned int BindAllocationValues[] = { OCI_BAM_EXTERNAL, OCI_BAM_INTERNAL };
 static unsigned int LongModeValues[]       = { OCI_LONG_EXPLICIT, OCI_LONG_IMPLICIT };
+static unsigned int NumModeValues[]        = { OCI_NDM_NUMBER, OCI_NDM_NATIVE };
+static unsigned int LobModeValues[]        = { OCI_LDM_LOCATOR, OCI_LDM_INLINE };
 
 /* ********************************************************************************************* *
  *                             PRIVATE FUNCTIONS
  * ********************************************************************************************* */
 
+#define OCI_IS_PLACEHOLDER_CHAR(c)                                  \
+    ((((c) >= OTEXT('a')) && ((c) <= OTEXT('z'))) ||                \
+     (((c) >= OTEXT('A')) && ((c) <= OTEXT('Z'))) ||                \
+     (((c) >= OTEXT('0')) && ((c) <= OTEXT('9'))) ||                \
+     ((c) == OTEXT('_')) || ((c) == OTEXT('$')) || ((c) == OTEXT('#')))
+
 #define SET_ARG_NUM(type, func)                                     \
     type src = func(rs, i), *dst = ( type *) va_arg(args, type *);  \
     if (dst)                                                        \
@@ -152,7 +160,9 @@ boolean OCI_BindCheck
         bnd = stmt->ubinds[i];
         ind = (sb2 *) bnd->buffer.inds;
 
-        if (OCI_CDT_CURSOR == bnd->type)
+        /* the bind plan gives the work to perform for the bind at execute time */
+
+        if (bnd->plan & OCI_BPL_CURSOR)
         {
             OCI_Statement *bnd_stmt = (OCI_Statement *) bnd->buffer.data;
 
@@ -178,18 +188,21 @@ boolean OCI_BindCheck
             }
         }
 
-        if (bnd->direction & OCI_BDM_IN)
-        {
-            /* for strings, re-initialize length array with buffer default size */
+        /* for strings, re-initialize length array with buffer default size
+           only if lengths have been modified since the last execution */
 
-            if (OCI_CDT_TEXT == bnd->type)
+        if ((bnd->plan & OCI_BPL_LENGTHS) && bnd->dirty)
+        {
+            for (j=0; j < bnd->buffer.count; j++)
             {
-                for (j=0; j < bnd->buffer.count; j++)
-                {
-                    *(ub2*)(((ub1 *)bnd->buffer.lens) + (sizeof(ub2) * (size_t) j)) = (ub2) bnd->size;
-                }
+                *(ub2*)(((ub1 *)bnd->buffer.lens) + (sizeof(ub2) * (size_t) j)) = (ub2) bnd->size;
             }
 
+            bnd->dirty = FALSE;
+        }
+
+        if (bnd->plan & OCI_BPL_VALUES)
+        {
             /* extra work for internal allocated binds buffers */
 
             if (!bnd->is_array)
@@ -236,10 +249,7 @@ boolean OCI_BindCheck
 
                 /* for handles, check anyway the value for null data */
 
-                if ((OCI_CDT_NUMERIC != bnd->type) &&
-                    (OCI_CDT_TEXT    != bnd->type) &&
-                    (OCI_CDT_RAW     != bnd->type)  &&
-                    (OCI_CDT_OBJECT  != bnd->type))
+                if (bnd->plan & OCI_BPL_NULLS)
                 {
                     if (ind && *ind != ((sb2) OCI_IND_NULL))
                     {
@@ -249,7 +259,7 @@ boolean OCI_BindCheck
 
                 /* update bind object indicator pointer with object indicator */
 
-                if (OCI_CDT_OBJECT == bnd->type)
+                if (bnd->plan & OCI_BPL_OBJECT)
                 {
                    if (*ind != ((sb2) OCI_IND_NULL) && bnd->buffer.data)
                    {
@@ -324,10 +334,7 @@ boolean OCI_BindCheck
 
                     /* for handles, check anyway the value for null data */
 
-                    if ((OCI_CDT_NUMERIC != bnd->type) &&
-                        (OCI_CDT_TEXT    != bnd->type) &&
-                        (OCI_CDT_RAW     != bnd->type) &&
-                        (OCI_CDT_OBJECT  != bnd->type))
+                    if (bnd->plan & OCI_BPL_NULLS)
                     {
                         if (ind && *ind != ((sb2) OCI_IND_NULL))
                         {
@@ -344,7 +351,7 @@ boolean OCI_BindCheck
 
                     /* update bind object indicator pointer with object indicator */
 
-                    if (OCI_CDT_OBJECT == bnd->type)
+                    if (bnd->plan & OCI_BPL_OBJECT)
                     {
                         if (*ind != ((sb2) OCI_IND_NULL) && bnd->buffer.data)
                         {
@@ -403,6 +410,15 @@ boolean OCI_BindReset
             bnd_stmt->type   = OCI_CST_SELECT;
         }
 
+        /* PL/SQL output values may have modified the string lengths */
+
+        if ((bnd->direction & OCI_BDM_OUT) && ((OCI_CST_BEGIN   == stmt->type) ||
+                                               (OCI_CST_DECLARE == stmt->type) ||
+                                               (OCI_CST_CALL    == stmt->type)))
+        {
+            bnd->dirty = TRUE;
+        }
+
         if ((bnd->direction & OCI_BDM_OUT) && (bnd->input) && (bnd->buffer.data))
         {
             /* only reset bind indicators if bind was not a PL/SQL bind
@@ -549,6 +565,7 @@ boolean OCI_BindData
 {
     boolean res      = TRUE;
     OCI_Bind *bnd    = NULL;
+    OCI_Placeholder *ph = NULL;
     ub4 exec_mode    = OCI_DEFAULT;
     boolean is_pltbl = FALSE;
     boolean is_array = FALSE;
@@ -558,6 +575,21 @@ boolean OCI_BindData
     int prev_index   = -1;
     size_t nballoc   = (size_t) nbelem;
 
+#if OCI_VERSION_COMPILE >= OCI_11_2
+
+    /* with 11gR2 client and server, big integers are bound as native 8 bytes
+       integers instead of being converted from/to OCINumber at each execution */
+
+    if ((OCI_CDT_NUMERIC == type) && (SQLT_VNU == code) &&
+        ((OCI_NUM_BIGINT == subtype) || (OCI_NUM_BIGUINT == subtype)) &&
+        (OCILib.version_runtime >= OCI_11_2) && (stmt->con->ver_num >= OCI_11_2))
+    {
+        code = (OCI_NUM_BIGUINT == subtype) ? SQLT_UIN : SQLT_INT;
+        size = (ub4) sizeof(big_int);
+    }
+
+#endif
+
     /* check index if necessary */
 
     if (OCI_BIND_BY_POS == stmt->bind_mode)
@@ -686,9 +718,12 @@ boolean OCI_BindData
             nballoc = (size_t) stmt->nb_iters_init;
         }
 
-        /* create hash table for mapping bind names / index */
+        /* create hash table for mapping bind names / index of the names
+           that have not been found in the SQL text */
+
+        ph = OCI_PlaceholderFind(stmt, name);
 
-        if (!stmt->map)
+        if (!ph && !stmt->map)
         {
             stmt->map = OCI_HashCreate(OCI_HASH_DEFAULT_SIZE, OCI_HASH_INTEGER);
 
@@ -702,7 +737,7 @@ boolean OCI_BindData
     {
         if (!bnd)
         {
-            bnd = (OCI_Bind *) OCI_MemAlloc(OCI_IPC_BIND, sizeof(*bnd), (size_t) 1, TRUE);
+            bnd = (OCI_Bind *) OCI_ArenaAlloc(&stmt->arena, sizeof(*bnd), (size_t) 1);
         }
 
         res = (NULL != bnd);
@@ -840,7 +875,7 @@ boolean OCI_BindData
 
         if (!bnd->name)
         {
-            bnd->name = ostrdup(name);
+            bnd->name = OCI_ArenaStrdup(&stmt->arena, name);
         }
 
         /* initialize buffer */
@@ -855,6 +890,15 @@ boolean OCI_BindData
             res = OCI_BindAllocData(bnd);
         }
 
+        /* compute the execute time work of the bind once for all executions */
+
+        if (res)
+        {
+            bnd->dirty = FALSE;
+
+            res = OCI_BindSetPlan(bnd);
+        }
+
         /* if we bind an OCI_Long or any output bind, we need to change the
            execution mode to provide data at execute time */
 
@@ -981,7 +1025,14 @@ boolean OCI_BindData
 
                 /* for user binds, add a positive index */
 
-                OCI_HashAddInt(stmt->map, name, stmt->nb_ubinds);
+                if (ph)
+                {
+                    ph->index = (int) stmt->nb_ubinds;
+                }
+                else
+                {
+                    OCI_HashAddInt(stmt->map, name, stmt->nb_ubinds);
+                }
             }
         }
         else
@@ -992,7 +1043,14 @@ boolean OCI_BindData
 
             index = (int) stmt->nb_rbinds;
 
-            OCI_HashAddInt(stmt->map, name, -index);
+            if (ph)
+            {
+                ph->index = -index;
+            }
+            else
+            {
+                OCI_HashAddInt(stmt->map, name, -index);
+            }
         }
     }
 
@@ -1007,6 +1065,238 @@ boolean OCI_BindData
     return res;
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_PlaceholderScan
+ * --------------------------------------------------------------------------------------------- */
+
+ub4 OCI_PlaceholderScan
+(
+    const otext     *sql,
+    OCI_Placeholder *phs
+)
+{
+    const otext *p = sql;
+    ub4 count      = 0;
+
+    while (*p)
+    {
+        if ((OTEXT('\'') == *p) || (OTEXT('"') == *p))
+        {
+            /* skip string literals and quoted identifiers */
+
+            otext quote = *p++;
+
+            while (*p && (*p != quote))
+            {
+                p++;
+            }
+
+            if (*p)
+            {
+                p++;
+            }
+        }
+        else if ((OTEXT('-') == p[0]) && (OTEXT('-') == p[1]))
+        {
+            /* skip single line comments */
+
+            while (*p && (*p != OTEXT('\n')))
+            {
+                p++;
+            }
+        }
+        else if ((OTEXT('/') == p[0]) && (OTEXT('*') == p[1]))
+        {
+            /* skip multi line comments */
+
+            p += 2;
+
+            while (*p && !((OTEXT('*') == p[0]) && (OTEXT('/') == p[1])))
+            {
+                p++;
+            }
+
+            if (*p)
+            {
+                p += 2;
+            }
+        }
+        else if ((OTEXT(':') == p[0]) && OCI_IS_PLACEHOLDER_CHAR(p[1]))
+        {
+            const otext *name = ++p;
+
+            while (OCI_IS_PLACEHOLDER_CHAR(*p))
+            {
+                p++;
+            }
+
+            if (phs)
+            {
+                phs[count].offset = (ub4) (name - sql);
+                phs[count].length = (ub4) (p - name);
+                phs[count].index  = 0;
+                phs[count].hash   = OCI_PlaceholderHash(name, phs[count].length);
+            }
+
+            count++;
+        }
+        else
+        {
+            p++;
+        }
+    }
+
+    return count;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_PlaceholderHash
+ * --------------------------------------------------------------------------------------------- */
+
+ub4 OCI_PlaceholderHash
+(
+    const otext *name,
+    ub4          length
+)
+{
+    ub4 h = 0;
+    ub4 i;
+
+    /* placeholder names are made of ASCII characters only */
+
+    for (i = 0; i < length; i++)
+    {
+        h = 31 * h + (ub4) (((name[i] >= OTEXT('a')) && (name[i] <= OTEXT('z'))) ?
+                            name[i] - OTEXT('a') + OTEXT('A') : name[i]);
+    }
+
+    return h;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_PlaceholderCompare
+ * --------------------------------------------------------------------------------------------- */
+
+int OCI_PlaceholderCompare
+(
+    const void *ph1,
+    const void *ph2
+)
+{
+    const OCI_Placeholder *p1 = *((OCI_Placeholder * const *) ph1);
+    const OCI_Placeholder *p2 = *((OCI_Placeholder * const *) ph2);
+
+    /* placeholders with the same hash are kept in SQL text order */
+
+    if (p1->hash != p2->hash)
+    {
+        return (p1->hash < p2->hash) ? -1 : 1;
+    }
+
+    return (p1->offset < p2->offset) ? -1 : ((p1->offset > p2->offset) ? 1 : 0);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_PlaceholderIndex
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_PlaceholderIndex
+(
+    OCI_Statement *stmt
+)
+{
+    ub4 i;
+
+    stmt->phs_index = (OCI_Placeholder **) OCI_ArenaAlloc(&stmt->arena, sizeof(*stmt->phs_index),
+                                                          (size_t) stmt->nb_phs);
+
+    OCI_CHECK(NULL == stmt->phs_index, FALSE)
+
+    for (i = 0; i < stmt->nb_phs; i++)
+    {
+        stmt->phs_index[i] = &stmt->phs[i];
+    }
+
+    qsort(stmt->phs_index, (size_t) stmt->nb_phs, sizeof(*stmt->phs_index), OCI_PlaceholderCompare);
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_PlaceholderFind
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Placeholder * OCI_PlaceholderFind
+(
+    OCI_Statement *stmt,
+    const otext   *name
+)
+{
+    ub4 i, j, lo, hi, hash;
+
+    OCI_CHECK(0 == stmt->nb_phs, NULL)
+
+    if (OCI_BIND_BY_POS == stmt->bind_mode)
+    {
+        /* positional binds directly use the slot of their position */
+
+        long pos = ostrtol(&name[1], NULL, 10);
+
+        OCI_CHECK((pos <= 0) || (pos > (long) stmt->nb_phs), NULL)
+
+        return &stmt->phs[pos - 1];
+    }
+
+    if (OTEXT(':') == *name)
+    {
+        name++;
+    }
+
+    hash = OCI_PlaceholderHash(name, (ub4) ostrlen(name));
+
+    /* look for the first placeholder with the name hash in the sorted index */
+
+    lo = 0;
+    hi = stmt->nb_phs;
+
+    while (lo < hi)
+    {
+        ub4 mid = lo + (hi - lo) / 2;
+
+        if (stmt->phs_index[mid]->hash < hash)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    /* then compare the names of the placeholders sharing that hash */
+
+    for (i = lo; (i < stmt->nb_phs) && (stmt->phs_index[i]->hash == hash); i++)
+    {
+        OCI_Placeholder *ph = stmt->phs_index[i];
+        const otext *str    = stmt->sql + ph->offset;
+
+        for (j = 0; j < ph->length; j++)
+        {
+            if (otoupper(str[j]) != otoupper(name[j]))
+            {
+                break;
+            }
+        }
+
+        if ((j == ph->length) && (0 == name[j]))
+        {
+            return ph;
+        }
+    }
+
+    return NULL;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_BindGetInternalIndex
  * --------------------------------------------------------------------------------------------- */
@@ -1017,10 +1307,22 @@ int OCI_BindGetInternalIndex
     const otext   *name
 )
 {
-    OCI_HashEntry *he = NULL;
-    int index         = -1;
+    OCI_HashEntry *he   = NULL;
+    OCI_Placeholder *ph = NULL;
+    int index           = -1;
 
-    if (stmt->map)
+    /* placeholders found in the SQL text are looked up without hashing */
+
+    ph = OCI_PlaceholderFind(stmt, name);
+
+    if (ph)
+    {
+        if (ph->index != 0)
+        {
+            index = (ph->index < 0) ? -ph->index : ph->index;
+        }
+    }
+    else if (stmt->map)
     {
         he = OCI_HashLookup(stmt->map, name, FALSE);
 
@@ -1244,6 +1546,9 @@ OCI_Statement * OCI_StatementInit
         stmt->bind_reuse      = FALSE;
         stmt->bind_mode       = OCI_BIND_BY_NAME;
         stmt->long_mode       = OCI_LONG_EXPLICIT;
+        stmt->num_mode        = OCI_NDM_NUMBER;
+        stmt->lob_mode        = OCI_LDM_LOCATOR;
+        stmt->lob_size        = OCI_SIZE_LOB_INLINE;
         stmt->bind_alloc_mode = OCI_BAM_EXTERNAL;
 
         res = TRUE;
@@ -1261,7 +1566,7 @@ OCI_Statement * OCI_StatementInit
 
             if (sql)
             {
-                stmt->sql = ostrdup(sql);
+                stmt->sql = OCI_ArenaStrdup(&stmt->arena, sql);
             }
             else
             {
@@ -1279,7 +1584,11 @@ OCI_Statement * OCI_StatementInit
 
                 if (res && dbstr)
                 {
-                    stmt->sql = OCI_StringDuplicateFromOracleString(dbstr, dbcharcount(dbsize));
+                    otext *sql_text = OCI_StringDuplicateFromOracleString(dbstr, dbcharcount(dbsize));
+
+                    stmt->sql = OCI_ArenaStrdup(&stmt->arena, sql_text);
+
+                    OCI_MemFree(sql_text);
 
                     res = (NULL != stmt->sql);
                 }
@@ -1332,10 +1641,48 @@ boolean OCI_StatementReset
 
 #endif
 
+    /* cancel a pending non blocking execution and restore the blocking mode
+       of the connection before releasing the statement resources */
+
+    if (stmt->exec_pending)
+    {
+        OCI_CALL2
+        (
+            res, stmt->con,
+
+            OCIBreak((dvoid *) stmt->con->cxt, stmt->con->err)
+        )
+
+        OCI_CALL2
+        (
+            res, stmt->con,
+
+            OCIReset((dvoid *) stmt->con->cxt, stmt->con->err)
+        )
+
+        OCI_ConnectionSetNonBlocking(stmt->con, FALSE);
+
+        stmt->exec_pending = FALSE;
+    }
+
     /* reset batch errors */
 
     res = OCI_BatchErrorClear(stmt);
 
+    /* keep the resultset of a select statement for the next execution if requested */
+
+    if (stmt->rs_reuse && (OCI_CST_SELECT == stmt->type) && !stmt->stmts &&
+        (1 == stmt->nb_rs) && stmt->rsts && stmt->rsts[0])
+    {
+        if (stmt->rs_spare)
+        {
+            OCI_ResultsetFree(stmt->rs_spare);
+        }
+
+        stmt->rs_spare = stmt->rsts[0];
+        stmt->rsts[0]  = NULL;
+    }
+
     /* free resultsets */
 
     res = OCI_ReleaseResultsets(stmt);
@@ -1351,6 +1698,19 @@ boolean OCI_StatementReset
         OCI_HashFree(stmt->map);
     }
 
+    /* free the returned rows counts left by an uncompleted execution */
+
+    if (stmt->ret_counts)
+    {
+        OCI_FREE(stmt->ret_counts)
+    }
+
+    /* placeholders table and index are allocated from the statement arena */
+
+    stmt->phs       = NULL;
+    stmt->phs_index = NULL;
+    stmt->nb_phs    = 0;
+
     /* free handle if needed */
 
     if (stmt->stmt)
@@ -1382,9 +1742,10 @@ boolean OCI_StatementReset
         }
     }
 
-    /* free sql statement */
+    /* release at once the objects allocated from the statement arena
+       (SQL text, binds and their names, placeholders, formatted values) */
 
-    OCI_FREE(stmt->sql)
+    OCI_ArenaReset(&stmt->arena);
 
     stmt->rsts          = NULL;
     stmt->stmts         = NULL;
@@ -1403,6 +1764,9 @@ boolean OCI_StatementReset
     stmt->nb_iters_init = 1;
     stmt->dynidx        = 0;
     stmt->err_pos       = 0;
+    stmt->chunked       = FALSE;
+    stmt->chunk_rows    = 0;
+    stmt->exec_pending  = FALSE;
 
     return res;
 }
@@ -1434,6 +1798,19 @@ boolean OCI_StatementClose
 
     res = OCI_StatementReset(stmt);
 
+    /* free the resultset kept for reuse */
+
+    if (stmt->rs_spare)
+    {
+        OCI_ResultsetFree(stmt->rs_spare);
+
+        stmt->rs_spare = NULL;
+    }
+
+    /* free the statement arena chunks */
+
+    OCI_ArenaFree(&stmt->arena);
+
     return res;
 }
 
@@ -1597,10 +1974,9 @@ boolean OCI_BatchErrorInit
         {
             /* allocate OCI error handle */
 
-            res = OCI_SUCCESSFUL(OCI_HandleAlloc((dvoid  *) stmt->con->env,
-                                                 (dvoid **) (void *) &hndl,
-                                                 (ub4) OCI_HTYPE_ERROR,
-                                                 (size_t) 0, (dvoid **) NULL));
+            res = OCI_SUCCESSFUL(OCI_HandleAllocCached((dvoid  *) stmt->con->env,
+                                                       (dvoid **) (void *) &hndl,
+                                                       (ub4) OCI_HTYPE_ERROR));
         }
 
         /* loop on the OCI errors to fill OCILIB error objects */
@@ -1659,8 +2035,64 @@ boolean OCI_BatchErrorInit
 
         if (hndl)
         {
-            OCI_HandleFree(hndl, OCI_HTYPE_ERROR);
+            OCI_HandleFreeCached((dvoid *) stmt->con->env, hndl, OCI_HTYPE_ERROR);
+        }
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_BatchErrorMerge
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_BatchErrorMerge
+(
+    OCI_Statement    *stmt,
+    OCI_BatchErrors **batch,
+    ub4               offset
+)
+{
+    boolean res = TRUE;
+    ub4 i;
+
+    OCI_CHECK(NULL == stmt->batch, TRUE)
+
+    /* rebase row offsets on the whole input */
+
+    for (i = 0; i < stmt->batch->count; i++)
+    {
+        stmt->batch->errs[i].row += offset;
+    }
+
+    if (NULL == *batch)
+    {
+        /* first rejected rows : take ownership of the statement error list */
+
+        *batch      = stmt->batch;
+        stmt->batch = NULL;
+    }
+    else
+    {
+        OCI_BatchErrors *dst = *batch;
+
+        dst->errs = (OCI_Error *) OCI_MemRealloc(dst->errs, OCI_IPC_ERROR, sizeof(*dst->errs),
+                                                 (size_t) (dst->count + stmt->batch->count));
+
+        res = (NULL != dst->errs);
+
+        if (res)
+        {
+            memcpy(&dst->errs[dst->count], stmt->batch->errs, sizeof(*dst->errs) * stmt->batch->count);
+
+            dst->count += stmt->batch->count;
+        }
+        else
+        {
+            dst->count = 0;
         }
+
+        OCI_BatchErrorClear(stmt);
     }
 
     return res;
@@ -1688,13 +2120,36 @@ boolean OCI_API OCI_PrepareInternal
     {
         /* store SQL */
 
-        stmt->sql = ostrdup(sql);
+        stmt->sql = OCI_ArenaStrdup(&stmt->arena, sql);
 
-        dbstr = OCI_StringGetOracleString(stmt->sql, &dbsize);
+        /* build the placeholders table once for all bind calls */
 
-        if (OCILib.version_runtime < OCI_9_2)
+        stmt->nb_phs = OCI_PlaceholderScan(stmt->sql, NULL);
+
+        if (stmt->nb_phs > 0)
         {
-            /* allocate handle */
+            stmt->phs = (OCI_Placeholder *) OCI_ArenaAlloc(&stmt->arena, sizeof(*stmt->phs),
+                                                           (size_t) stmt->nb_phs);
+
+            if (stmt->phs)
+            {
+                OCI_PlaceholderScan(stmt->sql, stmt->phs);
+            }
+
+            /* named binds are looked up through an index sorted by name hash */
+
+            if (!stmt->phs || !OCI_PlaceholderIndex(stmt))
+            {
+                stmt->phs    = NULL;
+                stmt->nb_phs = 0;
+            }
+        }
+
+        dbstr = OCI_StringGetOracleString(stmt->sql, &dbsize);
+
+        if (OCILib.version_runtime < OCI_9_2)
+        {
+            /* allocate handle */
 
             res = OCI_SUCCESSFUL(OCI_HandleAlloc((dvoid *) stmt->con->env,
                                                  (dvoid **) (void *) &stmt->stmt,
@@ -1779,6 +2234,16 @@ boolean OCI_API OCI_ExecuteInternal
     sword status = OCI_SUCCESS;
     ub4 iters    = 0;
 
+    /* while the connection is in non blocking mode, only OCI_ExecuteAsync() can run
+       an execution, blocking callers fail instead of silently not executing */
+
+    if (stmt->con->nb_mode && !stmt->con->nb_call)
+    {
+        OCI_ExceptionAsyncPending(stmt->con, stmt);
+
+        return FALSE;
+    }
+
     /* set up iterations and mode values for execution */
 
     if (OCI_CST_SELECT == stmt->type)
@@ -1797,34 +2262,41 @@ boolean OCI_API OCI_ExecuteInternal
         }
     }
 
-    /* reset batch errors */
+    /* a pending non blocking execution is resumed without setting it up again */
 
-    OCI_BatchErrorClear(stmt);
+    if (!stmt->exec_pending)
+    {
+        /* reset batch errors */
 
-    /* check bind objects for updating their null indicator status */
+        OCI_BatchErrorClear(stmt);
 
-    res = res && OCI_BindCheck(stmt);
+        stmt->chunked = FALSE;
 
-    /* check current resultsets */
+        /* check bind objects for updating their null indicator status */
 
-    if (res && stmt->rsts)
-    {
-        /* resultsets are freed before any prepare operations.
-           So, if we got ones here, it means the same SQL order
-           is re-executed */
+        res = res && OCI_BindCheck(stmt);
 
-        if (OCI_CST_SELECT == stmt->type)
-        {
-            /* just reinitialize the current resultset */
+        /* check current resultsets */
 
-            res = OCI_ResultsetInit(stmt->rsts[0]);
-        }
-        else
+        if (res && stmt->rsts)
         {
-            /* Must free previous resultsets for 'returning into'
-               SQL orders that can produce multiple resultsets */
+            /* resultsets are freed before any prepare operations.
+               So, if we got ones here, it means the same SQL order
+               is re-executed */
+
+            if (OCI_CST_SELECT == stmt->type)
+            {
+                /* just reinitialize the current resultset */
 
-            res = OCI_ReleaseResultsets(stmt);
+                res = OCI_ResultsetInit(stmt->rsts[0]);
+            }
+            else
+            {
+                /* Must free previous resultsets for 'returning into'
+                   SQL orders that can produce multiple resultsets */
+
+                res = OCI_ReleaseResultsets(stmt);
+            }
         }
     }
 
@@ -1833,10 +2305,35 @@ boolean OCI_API OCI_ExecuteInternal
     status = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err, iters,
                             (ub4) 0, (OCISnapshot *) NULL, (OCISnapshot *) NULL, mode);
 
+    /* in non blocking mode, the call has to be repeated until it completes */
+
+    stmt->exec_pending = (OCI_STILL_EXECUTING == status);
+
+    OCI_CHECK(stmt->exec_pending, TRUE)
+
+    /* the remaining calls (commit, implicit results, ...) are blocking ones */
+
+    if (stmt->con->nb_mode)
+    {
+        OCI_ConnectionSetNonBlocking(stmt->con, FALSE);
+    }
+
     /* reset input binds indicators status even if execution failed */
 
     OCI_BindReset(stmt);
 
+    /* in preallocated returning mode, pack the rows returned by all iterations */
+
+    if (stmt->ret_counts)
+    {
+        if (stmt->rsts && stmt->rsts[0])
+        {
+            OCI_ResultsetPackRows(stmt->rsts[0], stmt->ret_rows, stmt->ret_counts, stmt->nb_iters);
+        }
+
+        OCI_FREE(stmt->ret_counts)
+    }
+
     /* check result */
 
     res = ((OCI_SUCCESS == status) || (OCI_SUCCESS_WITH_INFO == status) || (OCI_NEED_DATA == status));
@@ -1956,12 +2453,12 @@ boolean OCI_API OCI_StatementFree
     OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     OCI_CHECK_OBJECT_FETCHED(stmt)
 
+    OCI_StatementCacheRemove(stmt->con, stmt);
+
     OCI_StatementClose(stmt);
 
     OCI_ListRemove(stmt->con->stmts, stmt);
 
-    OCI_FREE(stmt)
-
     call_retval = call_status = TRUE;
 
     OCI_LIB_CALL_EXIT()
@@ -2061,6 +2558,146 @@ boolean OCI_API OCI_Execute
     OCI_LIB_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ExecuteAsync
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_ExecuteAsync
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, OCI_ASYNC_ERROR)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    OCI_CHECK_NON_BLOCKING_PENDING(stmt->con, stmt, stmt->exec_pending)
+
+    /* blocking mode is restored by OCI_ExecuteInternal() once the execution completes */
+
+    call_status = OCI_ConnectionSetNonBlocking(stmt->con, TRUE);
+
+    stmt->con->nb_call = TRUE;
+
+    call_status = call_status && OCI_ExecuteInternal(stmt, OCI_DEFAULT);
+
+    stmt->con->nb_call = FALSE;
+
+    if (call_status)
+    {
+        call_retval = stmt->exec_pending ? OCI_ASYNC_PENDING : OCI_ASYNC_DONE;
+    }
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_IsExecutionPending
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_IsExecutionPending
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    call_retval = stmt->exec_pending;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ExecuteChunked
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_ExecuteChunked
+(
+    OCI_Statement  *stmt,
+    POCI_CHUNK_FILL proc,
+    void           *arg
+)
+{
+    OCI_BatchErrors *batch = NULL;
+
+    boolean res  = TRUE;
+    boolean done = FALSE;
+    ub4 size     = 0;
+    ub4 offset   = 0;
+    ub4 total    = 0;
+
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    OCI_CHECK_PTR(OCI_IPC_PROC, proc)
+    OCI_CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+
+    /* chunks are executed in blocking mode : they cannot be left pending */
+
+    OCI_CHECK_NON_BLOCKING_PENDING(stmt->con, stmt, FALSE)
+
+    /* the bind arrays allocated at bind time are the chunk buffers. Error lists left
+       by previous executions must not be taken for the ones of the first chunk */
+
+    size = stmt->nb_iters_init;
+
+    OCI_BatchErrorClear(stmt);
+
+    while (res && !done)
+    {
+        ub4 rows = (ub4) proc(stmt, (unsigned int) size, arg);
+
+        if (rows > size)
+        {
+            rows = size;
+        }
+
+        if (rows > 0)
+        {
+            ub4 count = 0;
+
+            stmt->nb_iters = rows;
+
+            /* rejected rows do not stop the input, only real errors do */
+
+            res = OCI_ExecuteInternal(stmt, OCI_BATCH_ERRORS) || (NULL != stmt->batch);
+
+            OCI_CALL1
+            (
+                res, stmt->con, stmt,
+
+                OCIAttrGet((dvoid *) stmt->stmt, (ub4) OCI_HTYPE_STMT,
+                           (void *) &count, (ub4 *) NULL, (ub4) OCI_ATTR_ROW_COUNT,
+                           stmt->con->err)
+            )
+
+            res = res && OCI_BatchErrorMerge(stmt, &batch, offset);
+
+            total  += count;
+            offset += rows;
+        }
+
+        /* a partial chunk means the end of the input */
+
+        done = (rows < size);
+    }
+
+    /* restore the bind array size and expose the results of the whole input */
+
+    OCI_BatchErrorClear(stmt);
+
+    stmt->nb_iters   = size;
+    stmt->batch      = batch;
+    stmt->chunked    = TRUE;
+    stmt->chunk_rows = total;
+
+    call_retval = call_status = res && (NULL == batch);
+
+    OCI_LIB_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_ExecuteStmt
  * --------------------------------------------------------------------------------------------- */
@@ -2166,9 +2803,15 @@ boolean OCI_PrepareFmt
 
             if (OCI_ParseSqlFmt(stmt, sql_fmt, sql, &args) > 0)
             {
-                /* parse buffer */
+                va_list bind_args;
 
-                call_status = OCI_PrepareInternal(stmt, sql_fmt);
+                /* parse buffer and bind values if requested */
+
+                va_start(bind_args, sql);
+
+                call_status = OCI_PrepareInternal(stmt, sql_fmt) && OCI_BindSqlFmt(stmt, sql, &bind_args);
+
+                va_end(bind_args);
             }
 
             va_end(args);
@@ -2223,9 +2866,16 @@ boolean OCI_ExecuteStmtFmt
 
             if (OCI_ParseSqlFmt(stmt, sql_fmt, sql, &args) > 0)
             {
-                /* prepare and execute SQL buffer */
+                va_list bind_args;
+
+                /* prepare, bind values if requested and execute SQL buffer */
 
-                call_status = (OCI_PrepareInternal(stmt, sql_fmt) && OCI_ExecuteInternal(stmt, OCI_DEFAULT));
+                va_start(bind_args, sql);
+
+                call_status = (OCI_PrepareInternal(stmt, sql_fmt) && OCI_BindSqlFmt(stmt, sql, &bind_args) &&
+                               OCI_ExecuteInternal(stmt, OCI_DEFAULT));
+
+                va_end(bind_args);
             }
 
             va_end(args);
@@ -2280,9 +2930,16 @@ boolean OCI_ParseFmt
 
             if (OCI_ParseSqlFmt(stmt, sql_fmt, sql, &args) > 0)
             {
-                /* prepare and execute SQL buffer */
+                va_list bind_args;
+
+                /* prepare, bind values if requested and execute SQL buffer */
 
-                call_status = (OCI_PrepareInternal(stmt, sql_fmt) && OCI_ExecuteInternal(stmt, OCI_PARSE_ONLY));
+                va_start(bind_args, sql);
+
+                call_status = (OCI_PrepareInternal(stmt, sql_fmt) && OCI_BindSqlFmt(stmt, sql, &bind_args) &&
+                               OCI_ExecuteInternal(stmt, OCI_PARSE_ONLY));
+
+                va_end(bind_args);
             }
 
             va_end(args);
@@ -2337,9 +2994,16 @@ boolean OCI_DescribeFmt
 
             if (OCI_ParseSqlFmt(stmt, sql_fmt, sql, &args) > 0)
             {
-                /* prepare and execute SQL buffer */
+                va_list bind_args;
+
+                /* prepare, bind values if requested and execute SQL buffer */
+
+                va_start(bind_args, sql);
 
-                call_status = (OCI_PrepareInternal(stmt, sql_fmt) && OCI_ExecuteInternal(stmt, OCI_DESCRIBE_ONLY));
+                call_status = (OCI_PrepareInternal(stmt, sql_fmt) && OCI_BindSqlFmt(stmt, sql, &bind_args) &&
+                               OCI_ExecuteInternal(stmt, OCI_DESCRIBE_ONLY));
+
+                va_end(bind_args);
             }
 
             va_end(args);
@@ -3995,6 +4659,91 @@ unsigned int OCI_API OCI_GetFetchSize
     OCI_LIB_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetBackgroundFetch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetBackgroundFetch
+(
+    OCI_Statement *stmt,
+    boolean        enable
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    if (enable)
+    {
+        OCI_CHECK_THREAD_ENABLED()
+    }
+
+    stmt->bg_fetch = enable;
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetBackgroundFetch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_GetBackgroundFetch
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    call_retval = stmt->bg_fetch;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetFetchWindow
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetFetchWindow
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    stmt->win_size = size;
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetFetchWindow
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetFetchWindow
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, 0)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    call_retval = stmt->win_size;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * "PrefetchSize
  * --------------------------------------------------------------------------------------------- */
@@ -4188,6 +4937,220 @@ unsigned int OCI_API OCI_GetLongMode
     OCI_LIB_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetNumericDefineMode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetNumericDefineMode
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    OCI_CHECK_ENUM_VALUE(stmt->con, stmt, mode, NumModeValues, OTEXT("Numeric Define Mode"))
+
+    stmt->num_mode = (ub1) mode;
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetNumericDefineMode
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetNumericDefineMode
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, OCI_UNKNOWN)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    call_retval = stmt->num_mode;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetLobDefineMode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetLobDefineMode
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    OCI_CHECK_ENUM_VALUE(stmt->con, stmt, mode, LobModeValues, OTEXT("Lob Define Mode"))
+
+    stmt->lob_mode = (ub1) mode;
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetLobDefineMode
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetLobDefineMode
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, OCI_UNKNOWN)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    call_retval = stmt->lob_mode;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetLobInlineSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetLobInlineSize
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    OCI_CHECK_MIN(stmt->con, stmt, size, 1)
+
+    stmt->lob_size = size;
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetLobInlineSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetLobInlineSize
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, 0)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    call_retval = stmt->lob_size;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetResultsetReuse
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetResultsetReuse
+(
+    OCI_Statement *stmt,
+    boolean        value
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    stmt->rs_reuse = value;
+
+    /* drop the kept resultset when disabling reuse */
+
+    if (!stmt->rs_reuse && stmt->rs_spare)
+    {
+        OCI_ResultsetFree(stmt->rs_spare);
+
+        stmt->rs_spare = NULL;
+    }
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetResultsetReuse
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_GetResultsetReuse
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    call_retval = stmt->rs_reuse;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_SetReturningRows
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_SetReturningRows
+(
+    OCI_Statement *stmt,
+    unsigned int   rows
+)
+{
+    OCI_LIB_CALL_ENTER(boolean, FALSE)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    stmt->ret_rows = rows;
+
+    call_retval = call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetReturningRows
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int OCI_API OCI_GetReturningRows
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_LIB_CALL_ENTER(unsigned int, 0)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    call_retval = stmt->ret_rows;
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_StatementGetConnection
  * --------------------------------------------------------------------------------------------- */
@@ -4263,14 +5226,21 @@ unsigned int OCI_API OCI_GetAffectedRows
 
     call_status = TRUE;
 
-    OCI_CALL1
-    (
-        call_status, stmt->con, stmt,
+    if (stmt->chunked)
+    {
+        count = stmt->chunk_rows;
+    }
+    else
+    {
+        OCI_CALL1
+        (
+            call_status, stmt->con, stmt,
 
-        OCIAttrGet((dvoid *) stmt->stmt, (ub4) OCI_HTYPE_STMT,
-                   (void *) &count, (ub4 *) NULL, (ub4) OCI_ATTR_ROW_COUNT,
-                   stmt->con->err)
-    )
+            OCIAttrGet((dvoid *) stmt->stmt, (ub4) OCI_HTYPE_STMT,
+                       (void *) &count, (ub4 *) NULL, (ub4) OCI_ATTR_ROW_COUNT,
+                       stmt->con->err)
+        )
+    }
 
     call_retval = count;
 
@@ -4389,6 +5359,35 @@ OCI_EXPORT unsigned int OCI_API OCI_GetBindIndex
     OCI_LIB_CALL_EXIT()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_GetBindHandle
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Bind * OCI_API OCI_GetBindHandle
+(
+    OCI_Statement *stmt,
+    const otext   *name
+)
+{
+    int index = -1;
+
+    OCI_LIB_CALL_ENTER(OCI_Bind*, NULL)
+
+    OCI_CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    OCI_CHECK_PTR(OCI_IPC_STRING, name)
+
+    index = OCI_BindGetInternalIndex(stmt, name);
+
+    if (index > 0)
+    {
+        call_retval = stmt->ubinds[index-1];
+    }
+
+    call_status = TRUE;
+
+    OCI_LIB_CALL_EXIT()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * OCI_GetSQLCommand
  * --------------------------------------------------------------------------------------------- */
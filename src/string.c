@@ -185,11 +185,32 @@ void OCI_StringTranslate
             unsigned short *str1 = (unsigned short *) src;
             unsigned int *str2   = (unsigned int   *) dst;
 
+            /* empty strings only need the wider null terminator */
+
             if (*str1 == 0)
             {
+                str2[0] = 0;
                 return;
             }
 
+            /* expansion goes backwards to be done in place and converts 4 characters
+               per iteration, all of them being read before being written */
+
+            while (char_count >= 4)
+            {
+                unsigned int c0 = (unsigned int) str1[char_count - 4];
+                unsigned int c1 = (unsigned int) str1[char_count - 3];
+                unsigned int c2 = (unsigned int) str1[char_count - 2];
+                unsigned int c3 = (unsigned int) str1[char_count - 1];
+
+                str2[char_count - 1] = c3;
+                str2[char_count - 2] = c2;
+                str2[char_count - 3] = c1;
+                str2[char_count - 4] = c0;
+
+                char_count -= 4;
+            }
+
             while (char_count--)
             {
                 str2[char_count] = (unsigned int) str1[char_count];
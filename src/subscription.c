@@ -374,7 +374,6 @@ OCI_Subscription * OCI_API OCI_SubscriptionRegister
     {
         OCI_SubscriptionClose(sub);
         OCI_ListRemove(OCILib.subs, sub);
-        OCI_FREE(sub)
     }
 
 #else
@@ -409,8 +408,6 @@ boolean OCI_API OCI_SubscriptionUnregister
 
     OCI_ListRemove(OCILib.subs, sub);
 
-    OCI_FREE(sub);
-
     OCI_LIB_CALL_EXIT()
 }
 
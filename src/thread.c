@@ -55,6 +55,36 @@ void OCI_ThreadProc
     }
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * OCI_ThreadClose
+ * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_ThreadClose
+(
+    OCI_Thread *thread
+)
+{
+    boolean res = TRUE;
+
+    OCI_CHECK(NULL == thread, FALSE)
+
+    /* a joined thread handle must be closed before being run again */
+
+    if (thread->opened)
+    {
+        OCI_CALL0
+        (
+            res, thread->err,
+
+            OCIThreadClose(OCILib.env, thread->err, thread->handle)
+        )
+
+        thread->opened = FALSE;
+    }
+
+    return res;
+}
+
 /* ********************************************************************************************* *
  *                            PUBLIC FUNCTIONS
  * ********************************************************************************************* */
@@ -137,12 +167,7 @@ boolean OCI_API OCI_ThreadFree
 
     if (thread->handle)
     {
-        OCI_CALL0
-        (
-            call_status, thread->err,
-
-            OCIThreadClose(OCILib.env, thread->err, thread->handle)
-        )
+        call_status = OCI_ThreadClose(thread);
 
         OCI_CALL0
         (
@@ -209,6 +234,8 @@ boolean OCI_API OCI_ThreadRun
                         thread, thread->id, thread->handle)
     )
 
+    thread->opened = call_status;
+
     call_retval = call_status;
 
     OCI_LIB_CALL_EXIT()
@@ -100,10 +100,9 @@ OCI_Timestamp * OCI_TimestampInit
         {
             if (OCI_OBJECT_ALLOCATED_ARRAY != tmsp->hstate)
             {
-                res = OCI_SUCCESSFUL(OCI_DescriptorAlloc((dvoid  *) tmsp->env,
-                                                         (dvoid **) (void *) &tmsp->handle,
-                                                         (ub4)OCI_ExternalSubTypeToHandleType(OCI_CDT_TIMESTAMP, type),
-                                                         (size_t) 0, (dvoid **) NULL));
+                res = OCI_SUCCESSFUL(OCI_DescriptorAllocCached((dvoid  *) tmsp->env,
+                                                               (dvoid **) (void *) &tmsp->handle,
+                                                               (ub4)OCI_ExternalSubTypeToHandleType(OCI_CDT_TIMESTAMP, type)));
                 tmsp->hstate = OCI_OBJECT_ALLOCATED;
             }
         }
@@ -187,7 +186,7 @@ boolean OCI_API OCI_TimestampFree
 
     if (OCI_OBJECT_ALLOCATED == tmsp->hstate)
     {
-        OCI_DescriptorFree((dvoid *)tmsp->handle, OCI_ExternalSubTypeToHandleType(OCI_CDT_TIMESTAMP, tmsp->type));
+        OCI_DescriptorFreeCached((dvoid *)tmsp->env, (dvoid *)tmsp->handle, OCI_ExternalSubTypeToHandleType(OCI_CDT_TIMESTAMP, tmsp->type));
     }
 
     if (OCI_OBJECT_ALLOCATED_ARRAY != tmsp->hstate)
@@ -153,8 +153,6 @@ boolean OCI_API OCI_TransactionFree
 
     OCI_ListRemove(trans->con->trsns, trans);
 
-    OCI_FREE(trans)
-
     call_retval = call_status;
 
     OCI_LIB_CALL_EXIT()
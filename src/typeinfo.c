@@ -555,11 +555,9 @@ boolean OCI_API OCI_TypeInfoFree
 
     if (typinf->refcount == 0)
     {
-        OCI_ListRemove(typinf->con->tinfs, typinf);
-
         OCI_TypeInfoClose(typinf);
 
-        OCI_FREE(typinf)
+        OCI_ListRemove(typinf->con->tinfs, typinf);
     }
 
     call_retval = call_status = TRUE;